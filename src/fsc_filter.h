@@ -0,0 +1,260 @@
+#pragma once
+
+// Per-axis input filter chains (median, One-Euro, EMA, slew limit, deadband),
+// shared by the plugin I/O thread and the offline tools. A chain is a fixed
+// array of stages with fixed-size state, so process() never allocates. Values
+// are raw channel counts; dt is the time since the previous sample or
+// advance(). The quadrant reports on change, so callers advance() the chain on
+// a clock between samples. No XPLM dependency.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace fsc_filter {
+
+enum class Kind { Median, OneEuro, Ema, Slew, Deadband, Count };
+constexpr const char* kKindNames[static_cast<size_t>(Kind::Count)] = {
+    "median", "one_euro", "ema", "slew", "deadband",
+};
+
+constexpr size_t kMaxStages = 8;
+constexpr int kMaxMedian = 9;
+
+struct StageConfig {
+    Kind kind = Kind::Ema;
+    int n = 3;                  // median: window (odd, 3..9 samples)
+    float minCutoffHz = 1.0f;   // one_euro: cutoff with the lever at rest
+    float beta = 0.01f;         // one_euro: cutoff increase per count/s of speed
+    float dCutoffHz = 1.0f;     // one_euro: cutoff of the speed estimate
+    float tauMs = 30.0f;        // ema: time constant
+    float maxRate = 800.0f;     // slew: counts/s
+    float band = 1.0f;          // deadband: changes up to this many counts are held
+};
+
+struct ChainConfig {
+    std::array<StageConfig, kMaxStages> stages{};
+    size_t count = 0;
+};
+
+inline bool kindFromName(const std::string& name, Kind& out) {
+    for (size_t i = 0; i < static_cast<size_t>(Kind::Count); ++i) {
+        if (name == kKindNames[i]) {
+            out = static_cast<Kind>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Clamps parameters to the ranges the stages are meant for (median windows
+// are rounded up to odd).
+inline void clampStage(StageConfig& s) {
+    s.n = std::clamp(s.n | 1, 3, kMaxMedian);
+    s.minCutoffHz = std::clamp(s.minCutoffHz, 0.01f, 50.0f);
+    s.beta = std::clamp(s.beta, 0.0f, 10.0f);
+    s.dCutoffHz = std::clamp(s.dCutoffHz, 0.01f, 50.0f);
+    s.tauMs = std::clamp(s.tauMs, 1.0f, 1000.0f);
+    s.maxRate = std::clamp(s.maxRate, 1.0f, 10000.0f);
+    s.band = std::clamp(s.band, 0.0f, 32.0f);
+}
+
+// "median(5) > one_euro(1 Hz, beta 0.01, d 1 Hz) > ema(30 ms)", for logs and reports.
+inline std::string describe(const ChainConfig& cfg) {
+    if (cfg.count == 0) {
+        return "none";
+    }
+    std::string out;
+    char buf[96];
+    for (size_t i = 0; i < cfg.count; ++i) {
+        const StageConfig& s = cfg.stages[i];
+        switch (s.kind) {
+            case Kind::Median: std::snprintf(buf, sizeof(buf), "median(%d)", s.n); break;
+            case Kind::OneEuro:
+                std::snprintf(buf, sizeof(buf), "one_euro(%g Hz, beta %g, d %g Hz)", s.minCutoffHz, s.beta,
+                              s.dCutoffHz);
+                break;
+            case Kind::Ema: std::snprintf(buf, sizeof(buf), "ema(%g ms)", s.tauMs); break;
+            case Kind::Slew: std::snprintf(buf, sizeof(buf), "slew(%g/s)", s.maxRate); break;
+            case Kind::Deadband: std::snprintf(buf, sizeof(buf), "deadband(%g)", s.band); break;
+            default: std::snprintf(buf, sizeof(buf), "?"); break;
+        }
+        if (i > 0) {
+            out += " > ";
+        }
+        out += buf;
+    }
+    return out;
+}
+
+// Compact form for the command line: stages separated by ',', parameters by
+// ':' in StageConfig order, e.g. "median:5,one_euro:1:0.01:1,ema:30,slew:800,deadband:1".
+// "none" is the empty chain.
+inline bool parseSpec(const std::string& spec, ChainConfig& out, std::string& err) {
+    out = ChainConfig{};
+    if (spec == "none") {
+        return true;
+    }
+    size_t pos = 0;
+    while (pos <= spec.size()) {
+        const size_t end = std::min(spec.find(',', pos), spec.size());
+        const std::string item = spec.substr(pos, end - pos);
+        pos = end + 1;
+        const size_t colon = item.find(':');
+        StageConfig s;
+        if (!kindFromName(item.substr(0, colon), s.kind)) {
+            err = "unknown filter '" + item.substr(0, colon) + "'";
+            return false;
+        }
+        float params[3] = {};
+        size_t nparams = 0;
+        for (size_t p = colon; p != std::string::npos && nparams < 3;) {
+            const char* start = item.c_str() + p + 1;
+            char* stop = nullptr;
+            params[nparams++] = std::strtof(start, &stop);
+            if (stop == start) {
+                err = "bad parameter in '" + item + "'";
+                return false;
+            }
+            p = item.find(':', p + 1);
+        }
+        switch (s.kind) {
+            case Kind::Median: s.n = nparams > 0 ? static_cast<int>(params[0]) : s.n; break;
+            case Kind::OneEuro:
+                s.minCutoffHz = nparams > 0 ? params[0] : s.minCutoffHz;
+                s.beta = nparams > 1 ? params[1] : s.beta;
+                s.dCutoffHz = nparams > 2 ? params[2] : s.dCutoffHz;
+                break;
+            case Kind::Ema: s.tauMs = nparams > 0 ? params[0] : s.tauMs; break;
+            case Kind::Slew: s.maxRate = nparams > 0 ? params[0] : s.maxRate; break;
+            case Kind::Deadband: s.band = nparams > 0 ? params[0] : s.band; break;
+            default: break;
+        }
+        if (out.count == kMaxStages) {
+            err = "more than " + std::to_string(kMaxStages) + " stages";
+            return false;
+        }
+        clampStage(s);
+        out.stages[out.count++] = s;
+    }
+    return true;
+}
+
+class Chain {
+public:
+    void configure(const ChainConfig& cfg) {
+        cfg_ = cfg;
+        reset();
+    }
+    void reset() {
+        state_ = {};
+        primed_ = false;
+    }
+    bool active() const { return cfg_.count > 0; }
+    const ChainConfig& config() const { return cfg_; }
+
+    // dtSec <= 0 (first sample, or samples with the same timestamp) holds the
+    // time-based stages; the first sample after reset() primes every stage.
+    float process(float x, float dtSec) {
+        input_ = x;
+        primed_ = true;
+        return run(x, dtSec, true);
+    }
+
+    // Advances the chain by dtSec without a new sample: the time-based stages
+    // step toward the last input. A median takes the held input only with
+    // |idle| (the lever has stopped reporting), so a single-sample spike is
+    // still outvoted by the samples around it. Returns -1 before the first
+    // sample.
+    float advance(float dtSec, bool idle) {
+        if (!primed_) {
+            return -1.0f;
+        }
+        return run(input_, dtSec, idle);
+    }
+
+private:
+    struct StageState {
+        std::array<float, kMaxMedian> window{};
+        int filled = 0;
+        int next = 0;
+        float y = 0.0f;
+        float prev = 0.0f;  // one_euro: previous input
+        float dx = 0.0f;
+        bool init = false;
+    };
+
+    static float lowPassAlpha(float cutoffHz, float dtSec) {
+        const float tau = 1.0f / (2.0f * 3.14159265f * cutoffHz);
+        return dtSec / (tau + dtSec);
+    }
+
+    float run(float x, float dtSec, bool pushMedian) {
+        for (size_t i = 0; i < cfg_.count; ++i) {
+            x = stage(cfg_.stages[i], state_[i], x, dtSec, pushMedian);
+        }
+        return x;
+    }
+
+    static float stage(const StageConfig& s, StageState& st, float x, float dt, bool pushMedian) {
+        if (s.kind == Kind::Median) {
+            if (pushMedian || st.filled == 0) {
+                st.window[static_cast<size_t>(st.next)] = x;
+                st.next = (st.next + 1) % s.n;
+                st.filled = std::min(st.filled + 1, s.n);
+            }
+            std::array<float, kMaxMedian> sorted = st.window;
+            std::sort(sorted.begin(), sorted.begin() + st.filled);
+            return sorted[static_cast<size_t>(st.filled / 2)];
+        }
+        if (!st.init) {
+            st.init = true;
+            st.y = x;
+            st.prev = x;
+            st.dx = 0.0f;
+            return x;
+        }
+        switch (s.kind) {
+            case Kind::OneEuro: {
+                if (dt <= 0.0f) {
+                    return st.y;
+                }
+                const float rawDx = (x - st.prev) / dt;
+                st.prev = x;
+                st.dx += lowPassAlpha(s.dCutoffHz, dt) * (rawDx - st.dx);
+                const float cutoff = s.minCutoffHz + s.beta * std::fabs(st.dx);
+                st.y += lowPassAlpha(cutoff, dt) * (x - st.y);
+                return st.y;
+            }
+            case Kind::Ema:
+                if (dt > 0.0f) {
+                    const float tau = s.tauMs / 1000.0f;
+                    st.y += dt / (tau + dt) * (x - st.y);
+                }
+                return st.y;
+            case Kind::Slew: {
+                const float step = s.maxRate * std::max(dt, 0.0f);
+                st.y += std::clamp(x - st.y, -step, step);
+                return st.y;
+            }
+            case Kind::Deadband:
+                if (std::fabs(x - st.y) > s.band) {
+                    st.y = x;
+                }
+                return st.y;
+            default:
+                return x;
+        }
+    }
+
+    ChainConfig cfg_{};
+    std::array<StageState, kMaxStages> state_{};
+    float input_ = 0.0f;
+    bool primed_ = false;
+};
+
+}  // namespace fsc_filter
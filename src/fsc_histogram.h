@@ -0,0 +1,67 @@
+#pragma once
+
+// Log-linear latency histogram (16 sub-buckets per power of two, about 6%
+// resolution, fixed size) shared by the plugin profiler, the link quality
+// report and the offline tools. No XPLM dependency.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+struct FscLatencyHistogram {
+    static constexpr int kSubBits = 4;
+    static constexpr int kSub = 1 << kSubBits;
+    static constexpr int kBuckets = (32 - kSubBits + 1) * kSub;
+    std::array<uint32_t, kBuckets> counts{};
+    uint64_t total = 0;
+    uint64_t sumNs = 0;
+    uint64_t maxNs = 0;
+
+    static int msb(uint64_t v) {
+        int n = 0;
+        for (int shift = 32; shift > 0; shift >>= 1) {
+            if (v >> shift) {
+                v >>= shift;
+                n += shift;
+            }
+        }
+        return n;
+    }
+    static int index(uint64_t ns) {
+        if (ns < static_cast<uint64_t>(kSub)) {
+            return static_cast<int>(ns);
+        }
+        const int shift = msb(ns) - kSubBits;
+        const int idx = (shift + 1) * kSub + static_cast<int>((ns >> shift) & (kSub - 1));
+        return std::min(idx, kBuckets - 1);
+    }
+    static uint64_t lowerBound(int idx) {
+        if (idx < kSub) {
+            return static_cast<uint64_t>(idx);
+        }
+        const int shift = idx / kSub - 1;
+        return static_cast<uint64_t>(kSub + idx % kSub) << shift;
+    }
+    void record(uint64_t ns) {
+        ++counts[static_cast<size_t>(index(ns))];
+        ++total;
+        sumNs += ns;
+        maxNs = std::max(maxNs, ns);
+    }
+    // Upper edge of the bucket holding the p-th percentile (capped at max).
+    uint64_t percentile(double p) const {
+        if (total == 0) {
+            return 0;
+        }
+        const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(total))));
+        uint64_t seen = 0;
+        for (int i = 0; i < kBuckets; ++i) {
+            seen += counts[static_cast<size_t>(i)];
+            if (seen >= rank) {
+                return std::min(maxNs, lowerBound(i + 1) - 1);
+            }
+        }
+        return maxNs;
+    }
+};
@@ -30,6 +30,7 @@
 #include "XPLMUtilities.h"
 #include "XPLMDataAccess.h"
 #include "XPLMMenus.h"
+#include "XPLMPlanes.h"
 #include "XPLMGraphics.h"
 #include "XPLMDisplay.h"
 #include "XPWidgets.h"
@@ -48,6 +49,7 @@
 #include <string>
 #include <thread>
 #include <chrono>
+#include <condition_variable>
 #include <unordered_map>
 #include <unordered_set>
 #include <fstream>
@@ -58,10 +60,16 @@
 #include <limits>
 #include <algorithm>
 #include <filesystem>
+#include <functional>
 #include <system_error>
 #include <cctype>
+#include <ctime>
 
 #include "plugin_utils.h"
+#include "fsc_filter.h"
+#include "fsc_histogram.h"
+#include "fsc_protocol.h"
+#include "fsc_raw_capture.h"
 
 namespace {
 
@@ -75,6 +83,21 @@ using socket_t = int;
 constexpr socket_t kInvalidSocket = -1;
 #endif
 
+// Flight recorder triggers (fsc.recorder_triggers), in kFscRecTriggerNames order.
+enum FscRecTrigger : uint32_t {
+    kFscRecSpike = 1u << 0,
+    kFscRecReadError = 1u << 1,
+    kFscRecReconnect = 1u << 2,
+    kFscRecUnknownCmd = 1u << 3,
+    kFscRecStale = 1u << 4,
+    kFscRecCommand = 1u << 5,
+};
+constexpr size_t kFscRecTriggerCount = 6;
+constexpr uint32_t kFscRecAllTriggers = (1u << kFscRecTriggerCount) - 1;
+const char* const kFscRecTriggerNames[kFscRecTriggerCount] = {
+    "spike", "read_error", "reconnect", "unknown_cmd", "stale", "command",
+};
+
 struct Prefs {
     bool logfileEnabled = true;
     std::string logfileName = PLUGIN_LOG_NAME;
@@ -89,6 +112,10 @@ struct Prefs {
         Even,
         Odd,
     };
+    enum class FscStaleAction {
+        Freeze,
+        Failsafe,
+    };
     struct FscCalib {
         // Defaults are based on the reference XLua scripts in Documentation/
         // (B738X.FSC_throttle_{semi_pro,pro,motorized}.lua)
@@ -140,6 +167,13 @@ struct Prefs {
         bool rts = true;
         bool xonxoff = false;
     };
+    struct FscRecorder {
+        bool enabled = true;
+        int preSec = 30;      // history kept before a trigger
+        int postSec = 5;      // recorded after a trigger before dumping
+        uint32_t triggers = kFscRecAllTriggers;
+        int spike = 64;       // raw axis jump per packet that counts as a spike
+    };
     struct FscPrefs {
         bool enabled = false;
         std::string port;
@@ -149,8 +183,22 @@ struct Prefs {
         int throttleSmoothMs = 60;
         int throttleDeadband = 1;
         float throttleSyncBand = 0.015f;
+        int staleMs = 3000;
+        FscStaleAction staleAction = FscStaleAction::Freeze;
         bool debug = false;
         bool rawLog = false;
+        bool rawLogBinary = false;
+        FscRecorder recorder;
+        bool profiler = false;
+        int profilerBudgetUs = 500;
+        bool trace = false;
+        int linkReportSec = 300;  // 0 = on demand only
+        int linkGapMs = 1500;
+        int outputPeriodMs = 10;  // I/O-thread output scheduler tick
+        int txBudgetPct = 60;     // share of the line (baud) output frames may use
+        int maxMotors = 4;        // motors powered at the same time (4 = no limit)
+        int motorDutyPct = 100;   // per-motor powered share of motor_duty_window_sec (100 = off)
+        int motorDutyWindowSec = 60;
         FscSerial serial;
         FscCalib calib;
         FscMotorCalib motor;
@@ -159,7 +207,74 @@ struct Prefs {
 
 bool g_pluginEnabled = false;
 std::ofstream g_fileLog;
-std::mutex g_logMutex;
+std::mutex g_logMutex;  // guards the sinks (g_fileLog, XPLMDebugString), not the producers
+std::string g_fileLogPath;  // guarded by g_logMutex
+size_t g_fileLogBytes = 0;  // guarded by g_logMutex
+
+// Asynchronous logger: logLine() formats into a slot of a bounded MPSC ring
+// (Vyukov sequence-numbered slots); a writer thread drains it in batches and
+// flushes once per batch. When the ring is full, lines are dropped and counted.
+struct AsyncLogRing {
+    static constexpr size_t kSlots = 512;  // power of two
+    static constexpr size_t kSlotBytes = 1024;
+    struct Slot {
+        std::atomic<size_t> seq{0};
+        uint32_t len = 0;
+        char text[kSlotBytes];
+    };
+    std::array<Slot, kSlots> slots;
+    alignas(64) std::atomic<size_t> enqueuePos{0};
+    alignas(64) size_t dequeuePos = 0;  // writer thread only
+
+    AsyncLogRing() {
+        for (size_t i = 0; i < kSlots; ++i) {
+            slots[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    Slot* acquire() {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots[pos & (kSlots - 1)];
+            const size_t seq = slot.seq.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return &slot;
+                }
+            } else if (diff < 0) {
+                return nullptr;  // full
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    static void publish(Slot* slot) {
+        // acquire() claimed position seq; readers wait for seq + 1.
+        slot->seq.store(slot->seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    bool popInto(std::string& out) {
+        Slot& slot = slots[dequeuePos & (kSlots - 1)];
+        const size_t seq = slot.seq.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(dequeuePos + 1) < 0) {
+            return false;
+        }
+        out.append(slot.text, slot.len);
+        slot.seq.store(dequeuePos + kSlots, std::memory_order_release);
+        ++dequeuePos;
+        return true;
+    }
+};
+
+AsyncLogRing g_logRing;
+std::atomic<bool> g_logWriterRunning{false};
+std::thread g_logWriterThread;
+std::mutex g_logWakeMutex;
+std::condition_variable g_logWake;
+std::atomic<uint64_t> g_logDropped{0};
+std::atomic<uint64_t> g_logWritten{0};
 enum class RawLogDir {
     None,
     Rx,
@@ -174,12 +289,201 @@ std::string g_fscRawLogLine;
 size_t g_fscRawLogLineBytes = 0;
 size_t g_fscRawLogBytes = 0;
 RawLogDir g_fscRawLogLineDir = RawLogDir::None;
+// Binary capture (fsc.raw_log_format=binary): fixed records staged in a
+// preallocated buffer and written in blocks.
+bool g_fscRawLogBinary = false;
+std::vector<fsc_raw::Record> g_fscRawBinBuf;
+size_t g_fscRawBinCount = 0;
+std::chrono::steady_clock::time_point g_fscRawBinLastWrite{};
+// Segment rotation runs on its own thread (all fields guarded by
+// g_fscRawLogMutex). While it is pending, output is kept in the spill buffer.
+std::thread g_fscRawRotateThread;
+std::condition_variable g_fscRawRotateCv;
+bool g_fscRawRotatePending = false;
+bool g_fscRawRotateStop = false;
+std::ofstream g_fscRawLogRetired;
+std::string g_fscRawLogPath;
+std::string g_fscRawLogSpill;
+uint64_t g_fscRawLogSpillDropped = 0;
+
+// Health metrics published as datarefs under FSCB738TQ/metrics/. Each value
+// sits on its own cache line; writers use relaxed atomics and dataref reads
+// are plain loads, so neither side takes a lock.
+struct alignas(64) FscMetricCounter {
+    std::atomic<uint64_t> value{0};
+    void add(uint64_t n = 1) { value.fetch_add(n, std::memory_order_relaxed); }
+    void set(uint64_t v) { value.store(v, std::memory_order_relaxed); }
+    uint64_t get() const { return value.load(std::memory_order_relaxed); }
+};
+struct alignas(64) FscMetricGauge {
+    std::atomic<float> value{0.0f};
+    void set(float v) { value.store(v, std::memory_order_relaxed); }
+    float get() const { return value.load(std::memory_order_relaxed); }
+};
+static_assert(sizeof(FscMetricCounter) == 64 && sizeof(FscMetricGauge) == 64, "metrics must be cache-line padded");
+
+constexpr size_t kFscCommandSlots = fsc_proto::kCommandSlots;  // packet command (b1 & 0x7E) >> 1
+
+struct FscMetrics {
+    FscMetricCounter packets;
+    FscMetricCounter badReads;
+    FscMetricCounter reconnects;
+    FscMetricCounter unknownPackets;
+    FscMetricCounter framingErrors;     // bytes without the start bit where a packet start was expected
+    FscMetricCounter secondByteTimeouts;
+    FscMetricCounter rxGaps;            // RX silences longer than fsc.link_gap_ms
+    FscMetricCounter foreignPackets;    // known commands not used by the configured fsc.type
+    FscMetricCounter servoStalls;       // throttle servo: lever did not follow its motor
+    FscMetricCounter servoOverrides;    // throttle servo: pilot moved the lever against the motor
+    FscMetricCounter outputDeferred;    // output frames held back to a later tick by the frame budget
+    FscMetricCounter trimIndicatorWrites; // trim indicator arrow retargets
+    FscMetricCounter motorPowerDenied;  // motor power requests held back by the governor
+    FscMetricCounter rxBytes;
+    FscMetricCounter txBytes;
+    FscMetricCounter connected;         // 0/1
+    FscMetricCounter lastRxNs;          // steady_clock time of the last RX byte, 0 = none
+    FscMetricCounter staleMask;         // fscChannelBit() of stale channels
+    FscMetricCounter logQueueDepth;     // lines waiting for the log writer
+    FscMetricCounter rawLogSpillBytes;  // RAW bytes buffered during a rotation
+    FscMetricGauge frameUs;             // last flight-loop callback
+    FscMetricGauge frameMaxUs;
+    FscMetricGauge packetsPerSec;
+    std::array<FscMetricCounter, kFscCommandSlots> cmdPackets;
+    std::array<FscMetricGauge, kFscCommandSlots> cmdPacketsPerSec;  // derived once per second (sim thread)
+    std::array<FscMetricCounter, kFscCommandSlots> cmdLastData;     // last data byte (b2), for the census
+};
+FscMetrics g_fscMetrics;
+std::vector<XPLMDataRef> g_fscMetricRefs;
 Prefs g_prefs;
 
+// Tracing (fsc.trace=1): spans and instant events go into a ring owned by the
+// recording thread (single writer, no locks on the hot path). The rings are
+// copied on FSCB738TQ/fsc_trace_export and written as Chrome trace-event JSON
+// (chrome://tracing, ui.perfetto.dev).
+struct FscTraceEvent {
+    uint64_t startNs = 0;  // since g_fscTraceEpoch
+    uint64_t durNs = 0;    // spans only
+    const char* name = "";  // string literal
+    int32_t arg = -1;       // -1 = none
+    char phase = 'X';       // 'X' span, 'i' instant
+};
+
+struct FscTraceBuffer {
+    static constexpr size_t kEvents = 1u << 15;  // power of two
+    std::string threadName;
+    uint32_t tid = 0;
+    std::unique_ptr<FscTraceEvent[]> events{new FscTraceEvent[kEvents]};
+    std::atomic<uint64_t> written{0};
+
+    void push(const FscTraceEvent& e) {
+        const uint64_t n = written.load(std::memory_order_relaxed);
+        events[n & (kEvents - 1)] = e;
+        written.store(n + 1, std::memory_order_release);
+    }
+};
+
+std::atomic<bool> g_fscTraceEnabled{false};
+std::chrono::steady_clock::time_point g_fscTraceEpoch{};  // set before tracing is enabled
+std::mutex g_fscTraceRegistryMutex;  // buffer registration and export only
+std::vector<std::unique_ptr<FscTraceBuffer>> g_fscTraceBuffers;
+thread_local FscTraceBuffer* t_fscTraceBuffer = nullptr;
+thread_local const char* t_fscTraceThreadName = nullptr;
+
+static bool fscTraceEnabled() {
+    return g_fscTraceEnabled.load(std::memory_order_relaxed);
+}
+
+// Names the calling thread in traces. A restarted thread with the same name
+// takes over the previous buffer, so the registry stays bounded.
+static void setFscTraceThreadName(const char* name) {
+    if (t_fscTraceThreadName != name) {
+        t_fscTraceThreadName = name;
+        t_fscTraceBuffer = nullptr;
+    }
+}
+
+static FscTraceBuffer* fscTraceBuffer() {
+    if (t_fscTraceBuffer) {
+        return t_fscTraceBuffer;
+    }
+    const std::string name = t_fscTraceThreadName ? t_fscTraceThreadName : "thread";
+    std::lock_guard<std::mutex> lock(g_fscTraceRegistryMutex);
+    for (auto& buf : g_fscTraceBuffers) {
+        if (buf->threadName == name) {
+            t_fscTraceBuffer = buf.get();
+            return t_fscTraceBuffer;
+        }
+    }
+    auto buf = std::make_unique<FscTraceBuffer>();
+    buf->threadName = name;
+    buf->tid = static_cast<uint32_t>(g_fscTraceBuffers.size() + 1);
+    t_fscTraceBuffer = buf.get();
+    g_fscTraceBuffers.push_back(std::move(buf));
+    return t_fscTraceBuffer;
+}
+
+static uint64_t fscTraceNs(std::chrono::steady_clock::time_point t) {
+    return t < g_fscTraceEpoch ? 0
+                               : static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     t - g_fscTraceEpoch).count());
+}
+
+static void fscTraceSpan(const char* name, std::chrono::steady_clock::time_point start,
+                         std::chrono::steady_clock::time_point end, int32_t arg = -1) {
+    FscTraceEvent e;
+    e.startNs = fscTraceNs(start);
+    e.durNs = end > start ? static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) : 0;
+    e.name = name;
+    e.arg = arg;
+    e.phase = 'X';
+    fscTraceBuffer()->push(e);
+}
+
+static void fscTraceInstant(const char* name, int32_t arg = -1) {
+    if (!fscTraceEnabled()) {
+        return;
+    }
+    FscTraceEvent e;
+    e.startNs = fscTraceNs(std::chrono::steady_clock::now());
+    e.name = name;
+    e.arg = arg;
+    e.phase = 'i';
+    fscTraceBuffer()->push(e);
+}
+
+// Records a span from construction to destruction when tracing is on.
+class FscTraceScope {
+public:
+    explicit FscTraceScope(const char* name, int32_t arg = -1)
+        : name_(name), arg_(arg), active_(fscTraceEnabled()) {
+        if (active_) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+    ~FscTraceScope() {
+        if (active_) {
+            fscTraceSpan(name_, start_, std::chrono::steady_clock::now(), arg_);
+        }
+    }
+    FscTraceScope(const FscTraceScope&) = delete;
+    FscTraceScope& operator=(const FscTraceScope&) = delete;
+
+private:
+    const char* name_;
+    int32_t arg_;
+    bool active_;
+    std::chrono::steady_clock::time_point start_{};
+};
+
 XPLMCommandRef g_cmdFscCalibStart = nullptr;
 XPLMCommandRef g_cmdFscCalibNext = nullptr;
 XPLMCommandRef g_cmdFscCalibCancel = nullptr;
 XPLMCommandRef g_cmdReloadPrefs = nullptr;
+XPLMCommandRef g_cmdRecorderDump = nullptr;
+XPLMCommandRef g_cmdProfilerDump = nullptr;
+XPLMCommandRef g_cmdTraceExport = nullptr;
+XPLMCommandRef g_cmdLinkReport = nullptr;
+XPLMCommandRef g_cmdCensus = nullptr;
 XPLMMenuID g_menuId = nullptr;
 int g_menuBaseItem = -1;
 int g_menuToggleItem = -1;
@@ -218,6 +522,8 @@ XPWidgetID g_fscFieldMotorTrimWheel02 = nullptr;
 XPWidgetID g_fscFieldMotorTrimWheel17 = nullptr;
 XPWidgetID g_fscFieldMotorThrottleRate = nullptr;
 XPWidgetID g_fscCalibStatus = nullptr;
+XPWidgetID g_fscHealthStatus = nullptr;
+XPWidgetID g_fscProfileStatus = nullptr;
 XPWidgetID g_fscBtnSaveApply = nullptr;
 XPWidgetID g_fscBtnReload = nullptr;
 XPWidgetID g_fscBtnCalibStart = nullptr;
@@ -227,10 +533,21 @@ XPWidgetID g_fscBtnClose = nullptr;
 std::string g_fscCalibStatusText = "Calibration: idle";
 static void* kMenuToggleWindow = reinterpret_cast<void*>(1);
 
+// Readiness engine: while pending, each frame re-probes only the still
+// unresolved profile paths (within a small time budget) and activates the
+// profile on the first frame they all resolve.
 struct DeferredInit {
+    struct PendingPath {
+        bool command = false;
+        std::string path;
+    };
     bool pending = false;
-    std::chrono::steady_clock::time_point due{};
-    int attempts = 0;
+    std::chrono::steady_clock::time_point started{};
+    std::string lastTail;
+    std::vector<PendingPath> unresolved;
+    size_t cursor = 0;
+    int frames = 0;
+    int probes = 0;
 };
 
 DeferredInit g_fscDeferredInit;
@@ -283,6 +600,25 @@ struct FscBindings {
     XPLMDataRef drRightToeBrake{nullptr};
 } g_fscBindings;
 
+// Input channels reported by the quadrant (index = bit in FscState::seen).
+using FscChannel = fsc_proto::Channel;
+constexpr size_t kFscChannelCount = fsc_proto::kChannelCount;
+constexpr uint32_t fscChannelBit(FscChannel ch) {
+    return 1u << static_cast<uint32_t>(ch);
+}
+constexpr uint32_t kFscSeenDigital = fscChannelBit(FscChannel::Digital);
+constexpr uint32_t kFscSeenStabTrim = fscChannelBit(FscChannel::StabTrim);
+constexpr uint32_t kFscSeenReverser1 = fscChannelBit(FscChannel::Reverser1);
+constexpr uint32_t kFscSeenReverser2 = fscChannelBit(FscChannel::Reverser2);
+constexpr uint32_t kFscSeenThrottle1 = fscChannelBit(FscChannel::Throttle1);
+constexpr uint32_t kFscSeenThrottle2 = fscChannelBit(FscChannel::Throttle2);
+constexpr uint32_t kFscSeenFlaps = fscChannelBit(FscChannel::Flaps);
+constexpr uint32_t kFscSeenSpeedbrake = fscChannelBit(FscChannel::Speedbrake);
+constexpr const char* const* kFscChannelNames = fsc_proto::kChannelNames;
+const char* const kFscChannelShortNames[kFscChannelCount] = {
+    "DIG", "TRIM", "REV1", "REV2", "THR1", "THR2", "FLAP", "SPD",
+};
+
 struct FscState {
     int digital = -1;
     int stabTrim = -1;  // bitfield from 0x96/0x97 packet (0x02 MAIN ELEC, 0x04 AUTO PILOT)
@@ -293,10 +629,130 @@ struct FscState {
     int throttle2 = -1;
     int flaps = -1;
     int speedbrake = -1;
+    uint32_t seen = 0;      // kFscSeen* bits received since (re)connect
+    bool complete = false;  // all required channels seen (or acquisition timed out)
+    // Per-channel last update (I/O thread clock) and smoothed inter-arrival time.
+    std::array<std::chrono::steady_clock::time_point, kFscChannelCount> updatedAt{};
+    std::array<float, kFscChannelCount> intervalMs{};
+    // Latest and previous axis input per channel at its samples (the profile's
+    // filter chain output, or the raw value without one), for the predictor.
+    std::array<float, kFscChannelCount> sampleValue{-1, -1, -1, -1, -1, -1, -1, -1};
+    std::array<float, kFscChannelCount> prevValue{-1, -1, -1, -1, -1, -1, -1, -1};
+    std::array<std::chrono::steady_clock::time_point, kFscChannelCount> prevAt{};
+    // Filter chain output, also advanced between samples (advanceFscAxisFilters()).
+    std::array<float, kFscChannelCount> filterValue{-1, -1, -1, -1, -1, -1, -1, -1};
+    std::array<std::chrono::steady_clock::time_point, kFscChannelCount> filterAt{};
 };
 
+static int* fscChannelValue(FscState& state, FscChannel ch) {
+    switch (ch) {
+        case FscChannel::Digital: return &state.digital;
+        case FscChannel::StabTrim: return &state.stabTrim;
+        case FscChannel::Reverser1: return &state.reverser1;
+        case FscChannel::Reverser2: return &state.reverser2;
+        case FscChannel::Throttle1: return &state.throttle1;
+        case FscChannel::Throttle2: return &state.throttle2;
+        case FscChannel::Flaps: return &state.flaps;
+        case FscChannel::Speedbrake: return &state.speedbrake;
+        default: return nullptr;
+    }
+}
+
 std::mutex g_fscMutex;
 FscState g_fscState;
+std::atomic<uint32_t> g_fscRequiredChannels{0};  // set by startFsc() from the active profile
+// Per-channel input filter chains from the profile axes, run by the I/O thread
+// for every sample and every output tick (guarded by g_fscMutex; see
+// configureFscFilters()).
+std::array<fsc_filter::Chain, kFscChannelCount> g_fscAxisFilters;
+
+static void recordFscChannelSample(FscChannel ch, int value, std::chrono::steady_clock::time_point now);
+
+// Caller holds g_fscMutex.
+static void markFscChannelLocked(FscChannel ch, std::chrono::steady_clock::time_point now) {
+    const size_t i = static_cast<size_t>(ch);
+    auto& last = g_fscState.updatedAt[i];
+    float dtMs = 0.0f;
+    if (last.time_since_epoch().count() != 0) {
+        dtMs = std::chrono::duration<float, std::milli>(now - last).count();
+        float& ema = g_fscState.intervalMs[i];
+        ema = (ema <= 0.0f) ? dtMs : ema + 0.1f * (dtMs - ema);
+    }
+    const int value = *fscChannelValue(g_fscState, ch);
+    auto& filter = g_fscAxisFilters[i];
+    const int staleMs = g_prefs.fsc.staleMs;
+    if (g_fscState.sampleValue[i] < 0.0f || (staleMs > 0 && dtMs > static_cast<float>(staleMs))) {
+        // First sample since (re)connect, an axis resync or a stale gap.
+        filter.reset();
+        g_fscState.sampleValue[i] = -1.0f;
+        g_fscState.filterValue[i] = -1.0f;
+    }
+    g_fscState.prevValue[i] = g_fscState.sampleValue[i];
+    g_fscState.prevAt[i] = last;
+    if (filter.active()) {
+        // The chain's own clock: the time since its last sample or advance.
+        const auto& filterAt = g_fscState.filterAt[i];
+        const float dtSec = g_fscState.filterValue[i] < 0.0f ? 0.0f
+                                                               : std::chrono::duration<float>(now - filterAt).count();
+        g_fscState.sampleValue[i] = filter.process(static_cast<float>(value), dtSec);
+    } else {
+        g_fscState.sampleValue[i] = static_cast<float>(value);
+    }
+    g_fscState.filterValue[i] = g_fscState.sampleValue[i];
+    g_fscState.filterAt[i] = now;
+    last = now;
+    g_fscState.seen |= fscChannelBit(ch);
+    recordFscChannelSample(ch, *fscChannelValue(g_fscState, ch), now);
+}
+
+// I/O thread, every loop: advances the filter chains of channels that have not
+// reported for an output period. The quadrant only reports on change (plus a
+// 1 s keepalive), so without this an EMA, One-Euro or slew stage would stop
+// short of a lever that came to rest until the next packet. A lever without a
+// sample for twice its last sample interval is idle (as in the predictor);
+// only then does a median take the held value.
+static void advanceFscAxisFilters(std::chrono::steady_clock::time_point now) {
+    const auto period = std::chrono::milliseconds(g_prefs.fsc.outputPeriodMs);
+    std::lock_guard<std::mutex> lock(g_fscMutex);
+    for (size_t i = 0; i < kFscChannelCount; ++i) {
+        auto& filter = g_fscAxisFilters[i];
+        if (!filter.active() || g_fscState.filterValue[i] < 0.0f || now - g_fscState.filterAt[i] < period) {
+            continue;
+        }
+        const float dtSec = std::chrono::duration<float>(now - g_fscState.filterAt[i]).count();
+        const float sinceSampleMs = std::chrono::duration<float, std::milli>(now - g_fscState.updatedAt[i]).count();
+        const float sampleDtMs =
+            g_fscState.prevAt[i].time_since_epoch().count() == 0
+                ? 0.0f
+                : std::chrono::duration<float, std::milli>(g_fscState.updatedAt[i] - g_fscState.prevAt[i]).count();
+        const bool idle = sinceSampleMs > 2.0f * sampleDtMs + 5.0f;
+        g_fscState.filterValue[i] = filter.advance(dtSec, idle);
+        g_fscState.filterAt[i] = now;
+    }
+}
+
+// Inbound packet commands (fsc_protocol.h). The table drives dispatch in
+// handleFscPacket(), the unknown/foreign checks in fscLoop() and the names in
+// the census and link reports.
+using FscPacketKind = fsc_proto::PacketKind;
+using FscCommandDesc = fsc_proto::CommandDesc;
+constexpr const auto& kFscCommandTable = fsc_proto::kCommandTable;
+constexpr uint8_t fscTypeBit(Prefs::FscType type) {
+    return static_cast<uint8_t>(1u << static_cast<unsigned>(type));
+}
+static_assert(fscTypeBit(Prefs::FscType::SemiPro) == fsc_proto::kTypeSemiPro &&
+                  fscTypeBit(Prefs::FscType::Pro) == fsc_proto::kTypePro &&
+                  fscTypeBit(Prefs::FscType::Motorized) == fsc_proto::kTypeMotorized,
+              "hardware type bits");
+
+constexpr const FscCommandDesc& fscCommandDesc(uint8_t cmd) {
+    return fsc_proto::commandDesc(cmd);
+}
+
+enum class FscChannelHealth { Unknown, Ok, Stale };
+
+// Sim-thread view of channel health (updated once per flight loop).
+std::array<FscChannelHealth, kFscChannelCount> g_fscChannelHealth{};
 std::atomic<bool> g_fscRunning{false};
 std::atomic<bool> g_fscResyncPending{false};
 std::atomic<bool> g_fscAxisResyncPending{false};
@@ -310,23 +766,120 @@ std::mutex g_fscIoMutex;
 std::atomic<bool> g_fscMotorThrottleActive{false};
 std::atomic<bool> g_fscMotorSpeedbrakeActive{false};
 
+// Closed-loop state of one motorized throttle lever (sim thread).
+struct FscThrottleServo {
+    enum class Mode { Idle, Driving, Holding, Stalled, Overridden };
+    Mode mode = Mode::Idle;
+    int lastMeasured = -1;
+    int lastErrorSign = 0;
+    int awayCounts = 0;     // lever travel away from the target (pilot override)
+    int progressPos = -1;   // lever position at the last progress mark
+    int progressError = 0;  // |error| at the last progress mark
+    int blockedTarget = -1; // motor target when a stall/override cut the power
+    std::chrono::steady_clock::time_point progressAt{};
+    std::chrono::steady_clock::time_point blockedUntil{};
+};
+
 struct FscOutputState {
-    bool parkBrakeLightKnown = false;
-    bool parkBrakeLightOn = false;
-    uint8_t digitalMask = 0;
-    uint8_t motorPowerMask = 0;
     int motorThrottle1Pos = -1;
     int motorThrottle2Pos = -1;
     int motorSpeedbrakePos = -1;
     int motorTrimIndPos = -1;
+    int trimIndPending = -1;  // latest arrow target not yet sent
+    std::chrono::steady_clock::time_point trimIndLastWrite{};
+    std::chrono::steady_clock::time_point trimIndPendingSince{};  // pending target unchanged since
     std::chrono::steady_clock::time_point speedbrakeMotorOffTime{};
+    std::chrono::steady_clock::time_point speedbrakeMoveStart{};
+    int speedbrakeMoveTarget = -1;  // lever position (calibration units) that ends the move, -1 = hold_ms only
+    const char* speedbrakeMove = nullptr;  // "deploy"/"stow" while a move is running
     std::chrono::steady_clock::time_point trimIndMotorOffTime{};
-    std::chrono::steady_clock::time_point lastThrottleUpdate{};
     float lastTrimWheel = std::numeric_limits<float>::quiet_NaN();
+    float trimRate = 0.0f;  // smoothed trim wheel rate (span/s)
+    std::chrono::steady_clock::time_point lastTrimTime{};
+    std::array<FscThrottleServo, 2> throttleServo{};
+    std::array<bool, 2> throttleMotion{};  // motion-profiled move toward a target in progress
+    int throttleHeldOff = 0;  // 0x93 throttle bits the governor held back (logged once per suspension)
 };
 
 FscOutputState g_fscOut;
 
+// Hardware output state of the 0x87/0x93 frames. The sim thread publishes
+// the desired state once per flight loop (g_fscOutputIntent); the I/O thread
+// keeps the last confirmed one and reconciles the two at a fixed rate
+// (FscOutputScheduler). -1 = not driven (desired) / unknown (confirmed).
+struct FscHwOutputs {
+    int digitalMask = -1;  // 0x87 0x10 (solenoids, backlight, trim wheel motor direction)
+    int parkLight = -1;    // 0x87 0x11 0x00 on / 0x87 0x10 0x00 off
+    int motorPower = -1;   // 0x93 0x00 mask
+};
+std::mutex g_fscOutputMutex;
+FscHwOutputs g_fscOutputIntent;
+std::atomic<int> g_fscMotorPowerDenied{0};  // 0x93 bits the I/O thread's governor currently holds back
+float g_fscTrimDuty = 0.0f;  // trim wheel motor duty, + = 0x20, - = 0x40 (g_fscOutputMutex)
+int g_fscTrimPwmMs = 200;
+
+// How the firmware treats the 0x87 frames. Firmwares differ, so the defaults
+// assume the worst of both: a mask write may or may not clear the park brake
+// light, and only 0x87 0x10 0x00 is known to switch it off.
+struct FscOutputQuirks {
+    bool maskWriteMayClearParkLight = true;  // re-send 0x87 0x11 after a mask write
+    bool parkOffOnlyByZeroMask = true;       // a non-zero mask write does not switch it off
+};
+constexpr FscOutputQuirks kFscOutputQuirks{};
+
+struct FscOutputFrame {
+    uint8_t a = 0;
+    uint8_t b = 0;
+    uint8_t c = 0;
+};
+
+// State after the hardware accepted |f|.
+static void applyFscOutputFrame(FscHwOutputs& state, const FscOutputFrame& f, const FscOutputQuirks& quirks) {
+    if (f.a == 0x93) {
+        state.motorPower = f.c;
+    } else if (f.a == 0x87 && f.b == 0x11) {
+        state.parkLight = 1;
+    } else if (f.a == 0x87 && f.b == 0x10) {
+        state.digitalMask = f.c;
+        if (f.c == 0) {
+            state.parkLight = 0;
+        } else if (quirks.maskWriteMayClearParkLight && state.parkLight == 1) {
+            state.parkLight = quirks.parkOffOnlyByZeroMask ? -1 : 0;
+        }
+    }
+}
+
+// Shortest frame sequence that takes |confirmed| to |desired| (fields at -1 in
+// |desired| are left alone). Returns the number of frames written to |out|.
+static size_t reconcileFscOutputs(FscHwOutputs confirmed, const FscHwOutputs& desired,
+                                  const FscOutputQuirks& quirks, std::array<FscOutputFrame, 4>& out) {
+    size_t n = 0;
+    auto emit = [&](uint8_t a, uint8_t b, uint8_t c) {
+        out[n] = FscOutputFrame{a, b, c};
+        applyFscOutputFrame(confirmed, out[n], quirks);
+        ++n;
+    };
+    if (desired.motorPower >= 0 && confirmed.motorPower != desired.motorPower) {
+        emit(0x93, 0x00, static_cast<uint8_t>(desired.motorPower));
+    }
+    if (desired.parkLight == 0 && confirmed.parkLight != 0) {
+        const bool maskTurnsOff = desired.digitalMask > 0 && quirks.maskWriteMayClearParkLight &&
+                                  !quirks.parkOffOnlyByZeroMask;
+        if (maskTurnsOff) {
+            emit(0x87, 0x10, static_cast<uint8_t>(desired.digitalMask));
+        } else {
+            emit(0x87, 0x10, 0x00);
+        }
+    }
+    if (desired.digitalMask >= 0 && confirmed.digitalMask != desired.digitalMask) {
+        emit(0x87, 0x10, static_cast<uint8_t>(desired.digitalMask));
+    }
+    if (desired.parkLight == 1 && confirmed.parkLight != 1) {
+        emit(0x87, 0x11, 0x00);
+    }
+    return n;
+}
+
 struct FscPrev {
     int fuel1 = -1;
     int fuel2 = -1;
@@ -499,7 +1052,11 @@ std::mutex g_fscCalibMutex;
 FscCalibWizard g_fscCalib;
 
 void processFscState(const FscState& state);
+static void updateFscChannelHealth(const FscState& state);
+static void applyFscStalePolicy(FscState& state);
 void processFscOutputs(const FscState& inputState);
+static void configureFscMotion();
+static void configureFscFilters();
 void updateFscCalibration(const FscState& inputState);
 bool fscIsConnected();
 static bool resyncFscLatchingInputs(const FscState& state);
@@ -563,6 +1120,58 @@ static void parseFscParity(const std::string& val, Prefs::FscParity& out) {
     }
 }
 
+static void parseFscStaleAction(const std::string& val, Prefs::FscStaleAction& out) {
+    std::string s;
+    s.reserve(val.size());
+    for (char c : val) {
+        s.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+    }
+    if (s == "FREEZE" || s == "HOLD") {
+        out = Prefs::FscStaleAction::Freeze;
+    } else if (s == "FAILSAFE" || s == "FAIL_SAFE" || s == "FAIL-SAFE") {
+        out = Prefs::FscStaleAction::Failsafe;
+    }
+}
+
+static void parseFscRawLogFormat(const std::string& val, bool& binary) {
+    std::string s;
+    s.reserve(val.size());
+    for (char c : trimString(val)) {
+        s.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+    }
+    if (s == "TEXT" || s == "TXT") {
+        binary = false;
+    } else if (s == "BINARY" || s == "BIN") {
+        binary = true;
+    } else {
+        logLine("FSC: unknown fsc.raw_log_format '" + val + "' (text|binary), keeping " +
+                (binary ? "binary" : "text"));
+    }
+}
+
+static void parseFscRecorderTriggers(const std::string& val, uint32_t& out) {
+    uint32_t mask = 0;
+    std::stringstream ss(val);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        std::string s;
+        for (char c : item) {
+            if (!std::isspace(static_cast<unsigned char>(c))) {
+                s.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+            }
+        }
+        if (s == "all") {
+            mask = kFscRecAllTriggers;
+        }
+        for (size_t i = 0; i < kFscRecTriggerCount; ++i) {
+            if (s == kFscRecTriggerNames[i]) {
+                mask |= 1u << i;
+            }
+        }
+    }
+    out = mask;  // "none" (or an empty list) disables all triggers
+}
+
 struct JsonValue {
     enum class Type { Null, Bool, Number, String, Array, Object };
     Type type = Type::Null;
@@ -836,6 +1445,15 @@ struct FscAxisTarget {
     int index = -1;
 };
 
+// Optional lever extrapolation to frame time (see predictFscAxisRaw()).
+struct FscAxisPredict {
+    bool enabled = false;
+    int maxLeadMs = 40;       // never extrapolate further ahead than this
+    float maxRate = 1500.0f;  // raw counts/s
+    int latencyMs = 16;       // sample age before the I/O thread sees it (USB serial latency timer)
+    std::vector<std::string> detentRefs;  // prefs: prediction stops at these raw positions
+};
+
 struct FscAxisMapping {
     bool defined = false;
     std::string sourceRefMin;
@@ -845,6 +1463,8 @@ struct FscAxisMapping {
     float targetMin = 0.0f;
     float targetMax = 1.0f;
     std::vector<FscAxisTarget> targets;
+    FscAxisPredict predict;
+    fsc_filter::ChainConfig filters;  // run on the I/O thread per sample (see fsc_filter.h)
 };
 
 struct FscSwitchMapping {
@@ -934,6 +1554,12 @@ struct FscMotorizedThrottleFollow {
     std::string thr2MinRef;
     std::string thr2MaxRef;
     std::string updateRateRef;
+    // Closed loop on the reported lever position (mapped through axes.throttle1/2).
+    bool servo = true;
+    int servoTolerance = 3;  // raw lever counts
+    int servoStallMs = 1500;
+    int servoOverrideCounts = 10;
+    int servoRetryMs = 3000;
 };
 
 struct FscMotorizedSpeedbrake {
@@ -942,6 +1568,7 @@ struct FscMotorizedSpeedbrake {
     int ratioDatarefType = 0;
     std::string armRef;
     std::string upRef;
+    std::string downRef;  // optional: lets an auto-stow end on arrival instead of hold_ms
     int tolerance = 3;
     float ratioUpMin = 0.99f;
     float ratioDownMax = 0.01f;
@@ -959,6 +1586,33 @@ struct FscMotorizedTrimIndicator {
     std::string arrowMinRef;
     std::string arrowMaxRef;
     int holdMs = 1500;
+    int deadband = 3;          // counts; smaller changes wait for the settle write
+    int minIntervalMs = 500;   // between two retargets while the trim is moving
+};
+
+// Motion profile limits in motor counts; 0 = unlimited.
+struct FscMotorLimits {
+    float maxRate = 0.0f;   // counts/s
+    float maxAccel = 0.0f;  // counts/s^2
+    float maxJerk = 0.0f;   // counts/s^3
+};
+
+struct FscMotorizedMotion {
+    bool enabled = true;
+    int periodMs = 25;
+    FscMotorLimits throttle{120.0f, 400.0f, 4000.0f};
+    FscMotorLimits speedbrake{250.0f, 1000.0f, 10000.0f};
+    FscMotorLimits trimIndicator{100.0f, 400.0f, 4000.0f};
+};
+
+// Trim wheel motor: direction bits 0x20/0x40 pulsed with a duty proportional
+// to the sim trim rate (fraction of the wheel_min..wheel_max span per second).
+struct FscMotorizedTrimWheel {
+    float fullRate = 0.05f;   // trim rate driven at 100% duty
+    float deadband = 0.002f;  // slower than this: wheel motor stopped
+    float maxDuty = 0.8f;
+    int pwmMs = 200;          // pulse period
+    int smoothMs = 150;       // rate estimate time constant
 };
 
 struct FscMotorizedBehavior {
@@ -966,6 +1620,8 @@ struct FscMotorizedBehavior {
     FscMotorizedThrottleFollow throttleFollow;
     FscMotorizedSpeedbrake speedbrake;
     FscMotorizedTrimIndicator trimIndicator;
+    FscMotorizedMotion motion;
+    FscMotorizedTrimWheel trimWheel;
     std::string onGroundDatarefPath;
     XPLMDataRef onGroundDataref = nullptr;
     int onGroundDatarefType = 0;
@@ -1018,6 +1674,31 @@ static std::string g_fscActiveProfileId;
 static std::string g_fscProfilePath;
 static std::vector<FscProfileRecord> g_fscProfiles;
 static std::chrono::steady_clock::time_point g_fscLastResync{};
+// Aircraft identity (tailnum + .acf path) the active profile was bound for.
+static std::string g_fscBoundTailnum;
+static std::string g_fscBoundAcfPath;
+
+// Interned binding table: one XPLMFind* per unique path per pass, resolved
+// handles are kept for the lifetime of the selected profile.
+struct FscBindingCache {
+    struct CommandEntry {
+        XPLMCommandRef cmd{nullptr};
+        int probedPass = 0;
+    };
+    struct DatarefEntry {
+        XPLMDataRef dataref{nullptr};
+        int types = 0;
+        int probedPass = 0;
+    };
+    std::unordered_map<std::string, CommandEntry> commands;
+    std::unordered_map<std::string, DatarefEntry> datarefs;
+    int pass = 0;
+    int lookups = 0;
+    int hits = 0;
+    int totalLookups = 0;
+};
+
+static FscBindingCache g_fscBindingCache;
 
 static bool getPrefIntByKey(const std::string& key, int& out) {
     const auto& c = g_prefs.fsc.calib;
@@ -1231,6 +1912,21 @@ static void logFscProfileDetails(const FscProfileRuntime& profile) {
                 ", " + invert +
                 ", target_range=[" + std::to_string(axis.targetMin) + "," + std::to_string(axis.targetMax) + "]" +
                 ", targets=" + targets);
+        if (axis.predict.enabled) {
+            std::string detents;
+            for (const auto& ref : axis.predict.detentRefs) {
+                detents += (detents.empty() ? "" : ",") + ref;
+            }
+            logLine("FSC: profile axis " + std::string(axisIdToString(static_cast<FscAxisId>(i))) +
+                    " predict: max_lead_ms=" + std::to_string(axis.predict.maxLeadMs) +
+                    ", max_rate=" + std::to_string(axis.predict.maxRate) +
+                    ", latency_ms=" + std::to_string(axis.predict.latencyMs) +
+                    ", detent_refs=" + (detents.empty() ? std::string("none") : detents));
+        }
+        if (axis.filters.count > 0) {
+            logLine("FSC: profile axis " + std::string(axisIdToString(static_cast<FscAxisId>(i))) +
+                    " filters: " + fsc_filter::describe(axis.filters));
+        }
     }
 
     for (size_t i = 0; i < profile.switches.size(); ++i) {
@@ -1356,10 +2052,16 @@ static void logFscProfileDetails(const FscProfileRuntime& profile) {
                 ", thr1_max_ref=" + motor.throttleFollow.thr1MaxRef +
                 ", thr2_min_ref=" + motor.throttleFollow.thr2MinRef +
                 ", thr2_max_ref=" + motor.throttleFollow.thr2MaxRef +
-                ", update_rate_ref=" + motor.throttleFollow.updateRateRef);
+                ", update_rate_ref=" + motor.throttleFollow.updateRateRef +
+                ", servo=" + std::string(motor.throttleFollow.servo ? "1" : "0") +
+                " (tolerance=" + std::to_string(motor.throttleFollow.servoTolerance) +
+                ", stall_ms=" + std::to_string(motor.throttleFollow.servoStallMs) +
+                ", override_counts=" + std::to_string(motor.throttleFollow.servoOverrideCounts) +
+                ", retry_ms=" + std::to_string(motor.throttleFollow.servoRetryMs) + ")");
         logLine("FSC: profile motor speedbrake: ratio_dataref=" + motor.speedbrake.ratioDatarefPath +
                 ", arm_ref=" + motor.speedbrake.armRef +
                 ", up_ref=" + motor.speedbrake.upRef +
+                ", down_ref=" + (motor.speedbrake.downRef.empty() ? std::string("(none)") : motor.speedbrake.downRef) +
                 ", motor_down_ref=" + motor.speedbrake.motorDownRef +
                 ", motor_up_ref=" + motor.speedbrake.motorUpRef +
                 ", tolerance=" + std::to_string(motor.speedbrake.tolerance) +
@@ -1371,7 +2073,24 @@ static void logFscProfileDetails(const FscProfileRuntime& profile) {
                 ", wheel_max_ref=" + motor.trimIndicator.wheelMaxRef +
                 ", arrow_min_ref=" + motor.trimIndicator.arrowMinRef +
                 ", arrow_max_ref=" + motor.trimIndicator.arrowMaxRef +
-                ", hold_ms=" + std::to_string(motor.trimIndicator.holdMs));
+                ", hold_ms=" + std::to_string(motor.trimIndicator.holdMs) +
+                ", deadband=" + std::to_string(motor.trimIndicator.deadband) +
+                ", min_interval_ms=" + std::to_string(motor.trimIndicator.minIntervalMs));
+        auto limitsText = [](const FscMotorLimits& l) {
+            std::ostringstream oss;
+            oss << l.maxRate << "/" << l.maxAccel << "/" << l.maxJerk;
+            return oss.str();
+        };
+        logLine("FSC: profile motor trim_wheel: full_rate=" + std::to_string(motor.trimWheel.fullRate) +
+                ", deadband=" + std::to_string(motor.trimWheel.deadband) +
+                ", max_duty=" + std::to_string(motor.trimWheel.maxDuty) +
+                ", pwm_ms=" + std::to_string(motor.trimWheel.pwmMs) +
+                ", smooth_ms=" + std::to_string(motor.trimWheel.smoothMs));
+        logLine("FSC: profile motor motion: enabled=" + std::string(motor.motion.enabled ? "1" : "0") +
+                ", period_ms=" + std::to_string(motor.motion.periodMs) +
+                ", rate/accel/jerk throttle=" + limitsText(motor.motion.throttle) +
+                " speedbrake=" + limitsText(motor.motion.speedbrake) +
+                " trim_indicator=" + limitsText(motor.motion.trimIndicator));
         std::string onGround = motor.onGroundDatarefPath.empty()
                                    ? "default(sim/flightmodel/failures/onground_any)"
                                    : motor.onGroundDatarefPath;
@@ -1624,7 +2343,9 @@ static bool parseAxisMapping(const JsonValue& obj,
         profileError(errors, ctx + ": axis mapping must be object");
         return false;
     }
-    checkAllowedKeys(obj, {"source_ref_min", "source_ref_max", "invert", "invert_ref", "target_range", "targets"}, ctx, errors);
+    checkAllowedKeys(obj, {"source_ref_min", "source_ref_max", "invert", "invert_ref", "target_range", "targets", "predict",
+                      "filters"},
+                     ctx, errors);
     readStringField(obj, "source_ref_min", true, out.sourceRefMin, ctx, errors);
     readStringField(obj, "source_ref_max", true, out.sourceRefMax, ctx, errors);
     readBoolField(obj, "invert", false, out.invert, ctx, errors);
@@ -1633,6 +2354,90 @@ static bool parseAxisMapping(const JsonValue& obj,
         profileError(errors, ctx + ": use only one of invert or invert_ref");
     }
     readNumberArray2(obj, "target_range", true, out.targetMin, out.targetMax, ctx, errors);
+    if (const JsonValue* predict = jsonGet(obj, "predict")) {
+        const std::string pctx = ctx + ".predict";
+        if (predict->type != JsonValue::Type::Object) {
+            profileError(errors, pctx + ": must be object");
+        } else {
+            checkAllowedKeys(*predict, {"enabled", "max_lead_ms", "max_rate", "latency_ms", "detent_refs"}, pctx, errors);
+            out.predict.enabled = true;
+            readBoolField(*predict, "enabled", false, out.predict.enabled, pctx, errors);
+            double d = 0.0;
+            if (readNumberField(*predict, "max_lead_ms", false, d, pctx, errors)) {
+                out.predict.maxLeadMs = std::clamp(static_cast<int>(d), 0, 100);
+            }
+            if (readNumberField(*predict, "max_rate", false, d, pctx, errors)) {
+                out.predict.maxRate = std::max(0.0f, static_cast<float>(d));
+            }
+            if (readNumberField(*predict, "latency_ms", false, d, pctx, errors)) {
+                out.predict.latencyMs = std::clamp(static_cast<int>(d), 0, 100);
+            }
+            if (const JsonValue* detents = jsonGet(*predict, "detent_refs")) {
+                if (detents->type != JsonValue::Type::Array) {
+                    profileError(errors, pctx + ".detent_refs: must be array");
+                } else {
+                    for (const auto& v : detents->arrayValue) {
+                        if (v.type != JsonValue::Type::String) {
+                            profileError(errors, pctx + ".detent_refs: entries must be strings");
+                            continue;
+                        }
+                        out.predict.detentRefs.push_back(v.stringValue);
+                    }
+                }
+            }
+        }
+    }
+    if (const JsonValue* filters = jsonGet(obj, "filters")) {
+        if (filters->type != JsonValue::Type::Array) {
+            profileError(errors, ctx + ".filters: must be array");
+        } else if (filters->arrayValue.size() > fsc_filter::kMaxStages) {
+            profileError(errors, ctx + ".filters: at most " + std::to_string(fsc_filter::kMaxStages) + " stages");
+        } else {
+            for (size_t i = 0; i < filters->arrayValue.size(); ++i) {
+                const JsonValue& f = filters->arrayValue[i];
+                const std::string fctx = ctx + ".filters[" + std::to_string(i) + "]";
+                if (f.type != JsonValue::Type::Object) {
+                    profileError(errors, fctx + ": must be object");
+                    continue;
+                }
+                checkAllowedKeys(f, {"type", "n", "min_cutoff_hz", "beta", "d_cutoff_hz", "tau_ms", "max_rate", "band"},
+                                 fctx, errors);
+                std::string type;
+                fsc_filter::StageConfig stage;
+                if (!readStringField(f, "type", true, type, fctx, errors)) {
+                    continue;
+                }
+                if (!fsc_filter::kindFromName(type, stage.kind)) {
+                    profileError(errors, fctx + ": invalid filter type '" + type + "'");
+                    continue;
+                }
+                double d = 0.0;
+                if (readNumberField(f, "n", false, d, fctx, errors)) {
+                    stage.n = static_cast<int>(d);
+                }
+                if (readNumberField(f, "min_cutoff_hz", false, d, fctx, errors)) {
+                    stage.minCutoffHz = static_cast<float>(d);
+                }
+                if (readNumberField(f, "beta", false, d, fctx, errors)) {
+                    stage.beta = static_cast<float>(d);
+                }
+                if (readNumberField(f, "d_cutoff_hz", false, d, fctx, errors)) {
+                    stage.dCutoffHz = static_cast<float>(d);
+                }
+                if (readNumberField(f, "tau_ms", false, d, fctx, errors)) {
+                    stage.tauMs = static_cast<float>(d);
+                }
+                if (readNumberField(f, "max_rate", false, d, fctx, errors)) {
+                    stage.maxRate = static_cast<float>(d);
+                }
+                if (readNumberField(f, "band", false, d, fctx, errors)) {
+                    stage.band = static_cast<float>(d);
+                }
+                fsc_filter::clampStage(stage);
+                out.filters.stages[out.filters.count++] = stage;
+            }
+        }
+    }
     const JsonValue* targets = jsonGet(obj, "targets");
     if (!targets || targets->type != JsonValue::Type::Array) {
         profileError(errors, ctx + ": targets must be array");
@@ -2005,7 +2810,8 @@ static bool parseMotorizedBehavior(const JsonValue& obj,
         profileError(errors, ctx + ": motorized must be object");
         return false;
     }
-    checkAllowedKeys(obj, {"enabled", "throttle_follow", "speedbrake_motor", "trim_indicator"}, ctx, errors);
+    checkAllowedKeys(obj, {"enabled", "throttle_follow", "speedbrake_motor", "trim_indicator", "motion", "trim_wheel"},
+                     ctx, errors);
     readBoolField(obj, "enabled", true, out.enabled, ctx, errors);
     const JsonValue* throttle = jsonGet(obj, "throttle_follow");
     const JsonValue* speedbrake = jsonGet(obj, "speedbrake_motor");
@@ -2022,7 +2828,8 @@ static bool parseMotorizedBehavior(const JsonValue& obj,
     }
     checkAllowedKeys(*throttle, {"lock_dataref", "arm_dataref", "lever_dataref", "motor_throttle1_min_ref",
                                  "motor_throttle1_max_ref", "motor_throttle2_min_ref", "motor_throttle2_max_ref",
-                                 "update_rate_ref"}, ctx + ".throttle_follow", errors);
+                                 "update_rate_ref", "servo", "servo_tolerance", "servo_stall_ms",
+                                 "servo_override_counts", "servo_retry_ms"}, ctx + ".throttle_follow", errors);
     readStringField(*throttle, "lock_dataref", true, out.throttleFollow.lockDatarefPath, ctx + ".throttle_follow", errors);
     readStringField(*throttle, "arm_dataref", true, out.throttleFollow.armDatarefPath, ctx + ".throttle_follow", errors);
     readStringField(*throttle, "lever_dataref", true, out.throttleFollow.leverDatarefPath, ctx + ".throttle_follow", errors);
@@ -2031,15 +2838,29 @@ static bool parseMotorizedBehavior(const JsonValue& obj,
     readStringField(*throttle, "motor_throttle2_min_ref", true, out.throttleFollow.thr2MinRef, ctx + ".throttle_follow", errors);
     readStringField(*throttle, "motor_throttle2_max_ref", true, out.throttleFollow.thr2MaxRef, ctx + ".throttle_follow", errors);
     readStringField(*throttle, "update_rate_ref", true, out.throttleFollow.updateRateRef, ctx + ".throttle_follow", errors);
+    readBoolField(*throttle, "servo", false, out.throttleFollow.servo, ctx + ".throttle_follow", errors);
+    double d = 0.0;
+    if (readNumberField(*throttle, "servo_tolerance", false, d, ctx + ".throttle_follow", errors)) {
+        out.throttleFollow.servoTolerance = std::max(0, static_cast<int>(d));
+    }
+    if (readNumberField(*throttle, "servo_stall_ms", false, d, ctx + ".throttle_follow", errors)) {
+        out.throttleFollow.servoStallMs = std::max(100, static_cast<int>(d));
+    }
+    if (readNumberField(*throttle, "servo_override_counts", false, d, ctx + ".throttle_follow", errors)) {
+        out.throttleFollow.servoOverrideCounts = std::max(1, static_cast<int>(d));
+    }
+    if (readNumberField(*throttle, "servo_retry_ms", false, d, ctx + ".throttle_follow", errors)) {
+        out.throttleFollow.servoRetryMs = std::max(0, static_cast<int>(d));
+    }
 
-    checkAllowedKeys(*speedbrake, {"ratio_dataref", "arm_ref", "up_ref", "tolerance", "ratio_up_min",
+    checkAllowedKeys(*speedbrake, {"ratio_dataref", "arm_ref", "up_ref", "down_ref", "tolerance", "ratio_up_min",
                                    "ratio_down_max", "motor_down_ref", "motor_up_ref", "hold_ms"}, ctx + ".speedbrake_motor", errors);
     readStringField(*speedbrake, "ratio_dataref", true, out.speedbrake.ratioDatarefPath, ctx + ".speedbrake_motor", errors);
     readStringField(*speedbrake, "arm_ref", true, out.speedbrake.armRef, ctx + ".speedbrake_motor", errors);
     readStringField(*speedbrake, "up_ref", true, out.speedbrake.upRef, ctx + ".speedbrake_motor", errors);
+    readStringField(*speedbrake, "down_ref", false, out.speedbrake.downRef, ctx + ".speedbrake_motor", errors);
     readStringField(*speedbrake, "motor_down_ref", true, out.speedbrake.motorDownRef, ctx + ".speedbrake_motor", errors);
     readStringField(*speedbrake, "motor_up_ref", true, out.speedbrake.motorUpRef, ctx + ".speedbrake_motor", errors);
-    double d = 0.0;
     if (readNumberField(*speedbrake, "tolerance", false, d, ctx + ".speedbrake_motor", errors)) {
         out.speedbrake.tolerance = static_cast<int>(d);
     }
@@ -2053,7 +2874,8 @@ static bool parseMotorizedBehavior(const JsonValue& obj,
         out.speedbrake.holdMs = static_cast<int>(d);
     }
 
-    checkAllowedKeys(*trim, {"wheel_dataref", "wheel_min_ref", "wheel_max_ref", "arrow_min_ref", "arrow_max_ref", "hold_ms"},
+    checkAllowedKeys(*trim, {"wheel_dataref", "wheel_min_ref", "wheel_max_ref", "arrow_min_ref", "arrow_max_ref", "hold_ms",
+                             "deadband", "min_interval_ms"},
                      ctx + ".trim_indicator", errors);
     readStringField(*trim, "wheel_dataref", true, out.trimIndicator.wheelDatarefPath, ctx + ".trim_indicator", errors);
     readStringField(*trim, "wheel_min_ref", true, out.trimIndicator.wheelMinRef, ctx + ".trim_indicator", errors);
@@ -2063,6 +2885,77 @@ static bool parseMotorizedBehavior(const JsonValue& obj,
     if (readNumberField(*trim, "hold_ms", false, d, ctx + ".trim_indicator", errors)) {
         out.trimIndicator.holdMs = static_cast<int>(d);
     }
+    if (readNumberField(*trim, "deadband", false, d, ctx + ".trim_indicator", errors)) {
+        out.trimIndicator.deadband = std::max(0, static_cast<int>(d));
+    }
+    if (readNumberField(*trim, "min_interval_ms", false, d, ctx + ".trim_indicator", errors)) {
+        out.trimIndicator.minIntervalMs = std::max(0, static_cast<int>(d));
+    }
+
+    if (const JsonValue* motion = jsonGet(obj, "motion")) {
+        const std::string mctx = ctx + ".motion";
+        if (motion->type != JsonValue::Type::Object) {
+            profileError(errors, mctx + ": must be object");
+            return false;
+        }
+        checkAllowedKeys(*motion, {"enabled", "period_ms", "throttle", "speedbrake", "trim_indicator"}, mctx, errors);
+        readBoolField(*motion, "enabled", false, out.motion.enabled, mctx, errors);
+        if (readNumberField(*motion, "period_ms", false, d, mctx, errors)) {
+            out.motion.periodMs = std::clamp(static_cast<int>(d), 10, 200);
+        }
+        auto readLimits = [&](const char* key, FscMotorLimits& limits) {
+            const JsonValue* block = jsonGet(*motion, key);
+            if (!block) {
+                return;
+            }
+            const std::string lctx = mctx + "." + key;
+            if (block->type != JsonValue::Type::Object) {
+                profileError(errors, lctx + ": must be object");
+                return;
+            }
+            checkAllowedKeys(*block, {"max_rate", "max_accel", "max_jerk"}, lctx, errors);
+            double v = 0.0;
+            if (readNumberField(*block, "max_rate", false, v, lctx, errors)) {
+                limits.maxRate = std::max(0.0f, static_cast<float>(v));
+            }
+            if (readNumberField(*block, "max_accel", false, v, lctx, errors)) {
+                limits.maxAccel = std::max(0.0f, static_cast<float>(v));
+            }
+            if (readNumberField(*block, "max_jerk", false, v, lctx, errors)) {
+                limits.maxJerk = std::max(0.0f, static_cast<float>(v));
+            }
+        };
+        readLimits("throttle", out.motion.throttle);
+        readLimits("speedbrake", out.motion.speedbrake);
+        readLimits("trim_indicator", out.motion.trimIndicator);
+    }
+    if (const JsonValue* wheel = jsonGet(obj, "trim_wheel")) {
+        const std::string wctx = ctx + ".trim_wheel";
+        if (wheel->type != JsonValue::Type::Object) {
+            profileError(errors, wctx + ": must be object");
+            return false;
+        }
+        checkAllowedKeys(*wheel, {"full_rate", "deadband", "max_duty", "pwm_ms", "smooth_ms"}, wctx, errors);
+        if (readNumberField(*wheel, "full_rate", false, d, wctx, errors)) {
+            if (d > 0.0) {
+                out.trimWheel.fullRate = static_cast<float>(d);
+            } else {
+                profileError(errors, wctx + ".full_rate: must be > 0");
+            }
+        }
+        if (readNumberField(*wheel, "deadband", false, d, wctx, errors)) {
+            out.trimWheel.deadband = std::max(0.0f, static_cast<float>(d));
+        }
+        if (readNumberField(*wheel, "max_duty", false, d, wctx, errors)) {
+            out.trimWheel.maxDuty = std::clamp(static_cast<float>(d), 0.0f, 1.0f);
+        }
+        if (readNumberField(*wheel, "pwm_ms", false, d, wctx, errors)) {
+            out.trimWheel.pwmMs = std::clamp(static_cast<int>(d), 40, 2000);
+        }
+        if (readNumberField(*wheel, "smooth_ms", false, d, wctx, errors)) {
+            out.trimWheel.smoothMs = std::clamp(static_cast<int>(d), 0, 2000);
+        }
+    }
     return true;
 }
 
@@ -2456,6 +3349,20 @@ static void normalizeFscThrottleFilter(Prefs::FscPrefs& fsc) {
     }
 }
 
+static void normalizeFscHealth(Prefs::FscPrefs& fsc) {
+    if (fsc.staleMs < 0) {
+        fsc.staleMs = 0;
+    }
+}
+
+static void normalizeFscRecorder(Prefs::FscRecorder& rec) {
+    rec.preSec = std::clamp(rec.preSec, 1, 300);
+    rec.postSec = std::clamp(rec.postSec, 0, 60);
+    if (rec.spike < 1) {
+        rec.spike = 1;
+    }
+}
+
 static bool writeDefaultPrefsFile(const Prefs& prefs);
 
 Prefs loadPrefs() {
@@ -2470,8 +3377,22 @@ Prefs loadPrefs() {
     prefs.fsc.throttleSmoothMs = 60;
     prefs.fsc.throttleDeadband = 1;
     prefs.fsc.throttleSyncBand = 0.015f;
+    prefs.fsc.staleMs = 3000;
+    prefs.fsc.staleAction = Prefs::FscStaleAction::Freeze;
     prefs.fsc.debug = false;
     prefs.fsc.rawLog = false;
+    prefs.fsc.rawLogBinary = false;
+    prefs.fsc.recorder = Prefs::FscRecorder{};
+    prefs.fsc.profiler = false;
+    prefs.fsc.profilerBudgetUs = 500;
+    prefs.fsc.trace = false;
+    prefs.fsc.linkReportSec = 300;
+    prefs.fsc.linkGapMs = 1500;
+    prefs.fsc.outputPeriodMs = 10;
+    prefs.fsc.txBudgetPct = 60;
+    prefs.fsc.maxMotors = 4;
+    prefs.fsc.motorDutyPct = 100;
+    prefs.fsc.motorDutyWindowSec = 60;
     prefs.fsc.serial.baud = 115200;
     prefs.fsc.serial.dataBits = 8;
     prefs.fsc.serial.stopBits = 1;
@@ -2523,8 +3444,26 @@ Prefs loadPrefs() {
         else if (key == "fsc.throttle_smooth_ms") prefs.fsc.throttleSmoothMs = std::stoi(val);
         else if (key == "fsc.throttle_deadband") prefs.fsc.throttleDeadband = std::stoi(val);
         else if (key == "fsc.throttle_sync_band") prefs.fsc.throttleSyncBand = std::stof(val);
+        else if (key == "fsc.stale_ms") prefs.fsc.staleMs = std::stoi(val);
+        else if (key == "fsc.stale_action") parseFscStaleAction(val, prefs.fsc.staleAction);
         else if (key == "fsc.debug") parseBool(val, prefs.fsc.debug);
         else if (key == "fsc.raw_log") parseBool(val, prefs.fsc.rawLog);
+        else if (key == "fsc.raw_log_format") parseFscRawLogFormat(val, prefs.fsc.rawLogBinary);
+        else if (key == "fsc.recorder") parseBool(val, prefs.fsc.recorder.enabled);
+        else if (key == "fsc.recorder_pre_sec") prefs.fsc.recorder.preSec = std::stoi(val);
+        else if (key == "fsc.recorder_post_sec") prefs.fsc.recorder.postSec = std::stoi(val);
+        else if (key == "fsc.recorder_triggers") parseFscRecorderTriggers(val, prefs.fsc.recorder.triggers);
+        else if (key == "fsc.recorder_spike") prefs.fsc.recorder.spike = std::stoi(val);
+        else if (key == "fsc.profiler") parseBool(val, prefs.fsc.profiler);
+        else if (key == "fsc.profiler_budget_us") prefs.fsc.profilerBudgetUs = std::stoi(val);
+        else if (key == "fsc.trace") parseBool(val, prefs.fsc.trace);
+        else if (key == "fsc.link_report_sec") prefs.fsc.linkReportSec = std::stoi(val);
+        else if (key == "fsc.link_gap_ms") prefs.fsc.linkGapMs = std::stoi(val);
+        else if (key == "fsc.output_period_ms") prefs.fsc.outputPeriodMs = std::stoi(val);
+        else if (key == "fsc.tx_budget_pct") prefs.fsc.txBudgetPct = std::stoi(val);
+        else if (key == "fsc.max_motors") prefs.fsc.maxMotors = std::stoi(val);
+        else if (key == "fsc.motor_duty_pct") prefs.fsc.motorDutyPct = std::stoi(val);
+        else if (key == "fsc.motor_duty_window_sec") prefs.fsc.motorDutyWindowSec = std::stoi(val);
         else if (key == "fsc.baud") prefs.fsc.serial.baud = std::stoi(val);
         else if (key == "fsc.data_bits") prefs.fsc.serial.dataBits = std::stoi(val);
         else if (key == "fsc.parity") parseFscParity(val, prefs.fsc.serial.parity);
@@ -2568,59 +3507,247 @@ Prefs loadPrefs() {
     }
     normalizeFscSerial(prefs.fsc.serial);
     normalizeFscThrottleFilter(prefs.fsc);
+    normalizeFscHealth(prefs.fsc);
+    normalizeFscRecorder(prefs.fsc.recorder);
+    if (prefs.fsc.profilerBudgetUs < 0) {
+        prefs.fsc.profilerBudgetUs = 0;
+    }
+    prefs.fsc.linkReportSec = std::max(0, prefs.fsc.linkReportSec);
+    prefs.fsc.linkGapMs = std::max(50, prefs.fsc.linkGapMs);
+    prefs.fsc.outputPeriodMs = std::clamp(prefs.fsc.outputPeriodMs, 5, 100);
+    prefs.fsc.txBudgetPct = std::clamp(prefs.fsc.txBudgetPct, 10, 100);
+    prefs.fsc.maxMotors = std::clamp(prefs.fsc.maxMotors, 1, 4);
+    prefs.fsc.motorDutyPct = std::clamp(prefs.fsc.motorDutyPct, 20, 100);
+    prefs.fsc.motorDutyWindowSec = std::clamp(prefs.fsc.motorDutyWindowSec, 5, 600);
     return prefs;
 }
 
-void logLine(const std::string& msg) {
-    std::string line = "[" + std::string(PLUGIN_LOG_PREFIX) + "] " + msg + "\n";
-    std::lock_guard<std::mutex> lock(g_logMutex);
-    XPLMDebugString(line.c_str());
-    if (g_fileLog.is_open()) {
-        g_fileLog << line;
-        g_fileLog.flush();
+// Shifts base -> base.1 -> ... -> base.<keep>, dropping the oldest segment.
+static void rotateLogSegments(const std::string& base, int keep) {
+    std::error_code ec;
+    std::filesystem::remove(base + "." + std::to_string(keep), ec);
+    for (int i = keep - 1; i >= 1; --i) {
+        std::string from = base + "." + std::to_string(i);
+        std::string to = base + "." + std::to_string(i + 1);
+        if (std::filesystem::exists(from, ec)) {
+            std::filesystem::rename(from, to, ec);
+        }
+    }
+    if (std::filesystem::exists(base, ec)) {
+        std::filesystem::rename(base, base + ".1", ec);
     }
 }
 
-static void openLogFileFromPrefs() {
-    if (g_fileLog.is_open()) {
-        g_fileLog.close();
-    }
-    if (!g_prefs.logfileEnabled) {
-        return;
+// Reserves disk blocks for a segment up front without changing its visible
+// size, so appends do not allocate. Best effort; Windows has no keep-size
+// equivalent and extends the file lazily.
+static void preallocateLogSegment(const std::string& path, size_t bytes) {
+#if LIN
+    int fd = ::open(path.c_str(), O_WRONLY);
+    if (fd >= 0) {
+        ::fallocate(fd, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(bytes));
+        ::close(fd);
     }
-    std::string logPath = makePluginPath("Resources/plugins/" + std::string(PLUGIN_DIR) + "/log/" + g_prefs.logfileName);
-    std::error_code ec;
-    std::filesystem::create_directories(std::filesystem::path(logPath).parent_path(), ec);
-    g_fileLog.open(logPath, std::ios::app);
-    if (!g_fileLog.is_open()) {
-        logLine("Warning: could not open logfile " + logPath);
-    } else {
-        logLine("Logfile opened at " + logPath);
+#elif APL
+    int fd = ::open(path.c_str(), O_WRONLY);
+    if (fd >= 0) {
+        fstore_t store{F_ALLOCATECONTIG, F_PEOFPOSMODE, 0, static_cast<off_t>(bytes), 0};
+        if (::fcntl(fd, F_PREALLOCATE, &store) == -1) {
+            store.fst_flags = F_ALLOCATEALL;
+            ::fcntl(fd, F_PREALLOCATE, &store);
+        }
+        ::close(fd);
     }
+#else
+    (void)path;
+    (void)bytes;
+#endif
 }
 
-std::string readTailnum() {
-    static XPLMDataRef tailRef = XPLMFindDataRef("sim/aircraft/view/acf_tailnum");
-    if (!tailRef) {
-        return {};
+constexpr size_t kLogMaxBytes = 10 * 1024 * 1024;
+constexpr int kLogMaxFiles = 3;
+
+// Runs on the log writer thread (or synchronously before start / after stop),
+// never on a producer.
+static void rotateLogFileLocked() {
+    g_fileLog.close();
+    rotateLogSegments(g_fileLogPath, kLogMaxFiles);
+    g_fileLog.open(g_fileLogPath, std::ios::trunc);
+    g_fileLogBytes = 0;
+    if (g_fileLog.is_open()) {
+        preallocateLogSegment(g_fileLogPath, kLogMaxBytes);
     }
-    char buf[256]{};
-    int n = XPLMGetDatab(tailRef, buf, 0, sizeof(buf) - 1);
-    if (n <= 0) {
-        return {};
+}
+
+static void writeLogBatchLocked(const std::string& batch) {
+    XPLMDebugString(batch.c_str());
+    if (!g_fileLog.is_open()) {
+        return;
     }
-    std::string raw(buf, static_cast<size_t>(n));
-    auto nul = raw.find('\0');
-    if (nul != std::string::npos) {
-        raw.resize(nul);
+    if (g_fileLogBytes + batch.size() > kLogMaxBytes) {
+        rotateLogFileLocked();
+        if (!g_fileLog.is_open()) {
+            return;
+        }
     }
-    return trimString(raw);
+    g_fileLog << batch;
+    g_fileLog.flush();
+    g_fileLogBytes += batch.size();
 }
 
-std::string fscTypeToString(Prefs::FscType type) {
-    switch (type) {
-        case Prefs::FscType::SemiPro: return "SEMIPRO";
-        case Prefs::FscType::Pro: return "PRO";
+void logLine(const std::string& msg) {
+    static const std::string prefix = "[" + std::string(PLUGIN_LOG_PREFIX) + "] ";
+    if (!g_logWriterRunning.load(std::memory_order_acquire)) {
+        // Before start / after stop: write synchronously.
+        std::lock_guard<std::mutex> lock(g_logMutex);
+        writeLogBatchLocked(prefix + msg + "\n");
+        return;
+    }
+    AsyncLogRing::Slot* slot = g_logRing.acquire();
+    if (!slot) {
+        g_logDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    constexpr size_t kMax = AsyncLogRing::kSlotBytes;
+    constexpr char kTruncated[] = "...\n";
+    size_t len = std::min(prefix.size(), kMax);
+    std::memcpy(slot->text, prefix.data(), len);
+    if (len + msg.size() + 1 <= kMax) {
+        std::memcpy(slot->text + len, msg.data(), msg.size());
+        len += msg.size();
+        slot->text[len++] = '\n';
+    } else {
+        const size_t room = kMax - len - (sizeof(kTruncated) - 1);
+        std::memcpy(slot->text + len, msg.data(), room);
+        len += room;
+        std::memcpy(slot->text + len, kTruncated, sizeof(kTruncated) - 1);
+        len += sizeof(kTruncated) - 1;
+    }
+    slot->len = static_cast<uint32_t>(len);
+    AsyncLogRing::publish(slot);
+}
+
+static void logWriterLoop() {
+    constexpr size_t kMaxBatchLines = 256;
+    constexpr auto kIdleWait = std::chrono::milliseconds(20);
+    std::string batch;
+    batch.reserve(64 * 1024);
+    uint64_t reportedDrops = 0;
+    for (;;) {
+        const bool running = g_logWriterRunning.load(std::memory_order_acquire);
+        size_t lines = 0;
+        while (lines < kMaxBatchLines && g_logRing.popInto(batch)) {
+            ++lines;
+        }
+        g_fscMetrics.logQueueDepth.set(g_logRing.enqueuePos.load(std::memory_order_relaxed) - g_logRing.dequeuePos);
+        const uint64_t dropped = g_logDropped.load(std::memory_order_relaxed);
+        if (dropped != reportedDrops) {
+            batch += "[" + std::string(PLUGIN_LOG_PREFIX) + "] Log: dropped " +
+                     std::to_string(dropped - reportedDrops) + " lines (queue full, total " +
+                     std::to_string(dropped) + ")\n";
+            reportedDrops = dropped;
+        }
+        if (!batch.empty()) {
+            {
+                std::lock_guard<std::mutex> lock(g_logMutex);
+                writeLogBatchLocked(batch);
+            }
+            g_logWritten.fetch_add(lines, std::memory_order_relaxed);
+            batch.clear();
+        }
+        if (lines == kMaxBatchLines) {
+            continue;  // more queued, keep draining
+        }
+        if (!running) {
+            break;
+        }
+        std::unique_lock<std::mutex> lock(g_logWakeMutex);
+        g_logWake.wait_for(lock, kIdleWait);
+    }
+}
+
+static void startLogWriter() {
+    if (g_logWriterRunning.load()) {
+        return;
+    }
+    g_logWriterRunning.store(true, std::memory_order_release);
+    g_logWriterThread = std::thread(logWriterLoop);
+}
+
+static void stopLogWriter() {
+    if (!g_logWriterRunning.load()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_logWakeMutex);
+        g_logWriterRunning.store(false, std::memory_order_release);
+    }
+    g_logWake.notify_one();
+    if (g_logWriterThread.joinable()) {
+        g_logWriterThread.join();
+    }
+}
+
+static void openLogFileFromPrefs() {
+    std::unique_lock<std::mutex> lock(g_logMutex);
+    if (g_fileLog.is_open()) {
+        g_fileLog.close();
+    }
+    if (!g_prefs.logfileEnabled) {
+        return;
+    }
+    std::string logPath = makePluginPath("Resources/plugins/" + std::string(PLUGIN_DIR) + "/log/" + g_prefs.logfileName);
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(logPath).parent_path(), ec);
+    g_fileLog.open(logPath, std::ios::app);
+    const bool opened = g_fileLog.is_open();
+    g_fileLogPath = logPath;
+    g_fileLogBytes = 0;
+    if (opened) {
+        std::error_code sizeEc;
+        g_fileLogBytes = static_cast<size_t>(std::filesystem::file_size(logPath, sizeEc));
+        if (sizeEc) {
+            g_fileLogBytes = 0;
+        }
+        preallocateLogSegment(logPath, kLogMaxBytes);
+    }
+    lock.unlock();
+    if (!opened) {
+        logLine("Warning: could not open logfile " + logPath);
+    } else {
+        logLine("Logfile opened at " + logPath);
+    }
+}
+
+std::string readTailnum() {
+    static XPLMDataRef tailRef = XPLMFindDataRef("sim/aircraft/view/acf_tailnum");
+    if (!tailRef) {
+        return {};
+    }
+    char buf[256]{};
+    int n = XPLMGetDatab(tailRef, buf, 0, sizeof(buf) - 1);
+    if (n <= 0) {
+        return {};
+    }
+    std::string raw(buf, static_cast<size_t>(n));
+    auto nul = raw.find('\0');
+    if (nul != std::string::npos) {
+        raw.resize(nul);
+    }
+    return trimString(raw);
+}
+
+std::string readAcfPath() {
+    char file[256]{};
+    char path[512]{};
+    XPLMGetNthAircraftModel(0, file, path);
+    return std::string(path);
+}
+
+std::string fscTypeToString(Prefs::FscType type) {
+    switch (type) {
+        case Prefs::FscType::SemiPro: return "SEMIPRO";
+        case Prefs::FscType::Pro: return "PRO";
         case Prefs::FscType::Motorized: return "MOTORIZED";
     }
     return "UNKNOWN";
@@ -2635,6 +3762,27 @@ std::string fscParityToString(Prefs::FscParity parity) {
     return "unknown";
 }
 
+std::string fscStaleActionToString(Prefs::FscStaleAction action) {
+    switch (action) {
+        case Prefs::FscStaleAction::Freeze: return "freeze";
+        case Prefs::FscStaleAction::Failsafe: return "failsafe";
+    }
+    return "unknown";
+}
+
+std::string fscRecorderTriggersToString(uint32_t triggers) {
+    std::string out;
+    for (size_t i = 0; i < kFscRecTriggerCount; ++i) {
+        if (triggers & (1u << i)) {
+            if (!out.empty()) {
+                out.push_back(',');
+            }
+            out += kFscRecTriggerNames[i];
+        }
+    }
+    return out.empty() ? "none" : out;
+}
+
 std::string fscSerialSummary(const Prefs::FscSerial& serial) {
     return "baud=" + std::to_string(serial.baud) +
            ", data_bits=" + std::to_string(serial.dataBits) +
@@ -2664,8 +3812,26 @@ static std::vector<std::string> buildDefaultPrefsLines(const Prefs& prefs) {
     lines.push_back("fsc.throttle_smooth_ms=" + std::to_string(prefs.fsc.throttleSmoothMs));
     lines.push_back("fsc.throttle_deadband=" + std::to_string(prefs.fsc.throttleDeadband));
     lines.push_back("fsc.throttle_sync_band=" + std::to_string(prefs.fsc.throttleSyncBand));
+    lines.push_back("fsc.stale_ms=" + std::to_string(prefs.fsc.staleMs));
+    lines.push_back("fsc.stale_action=" + fscStaleActionToString(prefs.fsc.staleAction));
     lines.push_back("fsc.debug=" + bool01(prefs.fsc.debug));
     lines.push_back("fsc.raw_log=" + bool01(prefs.fsc.rawLog));
+    lines.push_back("fsc.raw_log_format=" + std::string(prefs.fsc.rawLogBinary ? "binary" : "text"));
+    lines.push_back("fsc.recorder=" + bool01(prefs.fsc.recorder.enabled));
+    lines.push_back("fsc.recorder_pre_sec=" + std::to_string(prefs.fsc.recorder.preSec));
+    lines.push_back("fsc.recorder_post_sec=" + std::to_string(prefs.fsc.recorder.postSec));
+    lines.push_back("fsc.recorder_triggers=" + fscRecorderTriggersToString(prefs.fsc.recorder.triggers));
+    lines.push_back("fsc.recorder_spike=" + std::to_string(prefs.fsc.recorder.spike));
+    lines.push_back("fsc.profiler=" + bool01(prefs.fsc.profiler));
+    lines.push_back("fsc.profiler_budget_us=" + std::to_string(prefs.fsc.profilerBudgetUs));
+    lines.push_back("fsc.trace=" + bool01(prefs.fsc.trace));
+    lines.push_back("fsc.link_report_sec=" + std::to_string(prefs.fsc.linkReportSec));
+    lines.push_back("fsc.link_gap_ms=" + std::to_string(prefs.fsc.linkGapMs));
+    lines.push_back("fsc.output_period_ms=" + std::to_string(prefs.fsc.outputPeriodMs));
+    lines.push_back("fsc.tx_budget_pct=" + std::to_string(prefs.fsc.txBudgetPct));
+    lines.push_back("fsc.max_motors=" + std::to_string(prefs.fsc.maxMotors));
+    lines.push_back("fsc.motor_duty_pct=" + std::to_string(prefs.fsc.motorDutyPct));
+    lines.push_back("fsc.motor_duty_window_sec=" + std::to_string(prefs.fsc.motorDutyWindowSec));
     lines.push_back("fsc.baud=" + std::to_string(prefs.fsc.serial.baud));
     lines.push_back("fsc.data_bits=" + std::to_string(prefs.fsc.serial.dataBits));
     lines.push_back("fsc.parity=" + fscParityToString(prefs.fsc.serial.parity));
@@ -2747,6 +3913,9 @@ std::string hexByte(uint8_t v) {
 static std::string rawLogFileName() {
     std::string base = g_prefs.logfileName.empty() ? std::string(PLUGIN_LOG_NAME) : g_prefs.logfileName;
     auto dot = base.rfind('.');
+    if (g_fscRawLogBinary) {
+        return (dot == std::string::npos ? base : base.substr(0, dot)) + "_raw.bin";
+    }
     if (dot == std::string::npos) {
         return base + "_raw";
     }
@@ -2757,59 +3926,166 @@ static std::string rawLogPath() {
     return makePluginPath("Resources/plugins/" + std::string(PLUGIN_DIR) + "/log/" + rawLogFileName());
 }
 
-static void rotateRawLogLocked() {
+constexpr size_t kRawLogMaxBytes = 5 * 1024 * 1024;
+constexpr int kRawLogMaxFiles = 3;
+// Bytes logged while a rotation is in flight; beyond this they are dropped.
+constexpr size_t kRawLogSpillMax = 1024 * 1024;
+
+// Appends to the current segment. At the size limit the segment is handed to
+// the rotation thread and output goes to the spill buffer until the next
+// segment is installed, so the caller never waits on the filesystem.
+static void appendRawLogLocked(const char* data, size_t len) {
+    if (!g_fscRawRotatePending && g_fscRawLog.is_open() && g_fscRawLogBytes + len > kRawLogMaxBytes) {
+        g_fscRawLogRetired = std::move(g_fscRawLog);
+        g_fscRawRotatePending = true;
+        if (!g_fscRawLogBinary) {
+            // Text timestamps restart with each segment.
+            g_fscRawLogStart = std::chrono::steady_clock::now();
+        }
+        g_fscRawRotateCv.notify_one();
+    }
+    if (g_fscRawRotatePending) {
+        if (g_fscRawLogSpill.size() + len <= kRawLogSpillMax) {
+            g_fscRawLogSpill.append(data, len);
+            g_fscMetrics.rawLogSpillBytes.set(g_fscRawLogSpill.size());
+        } else {
+            ++g_fscRawLogSpillDropped;
+        }
+        return;
+    }
     if (g_fscRawLog.is_open()) {
-        g_fscRawLog.close();
+        g_fscRawLog.write(data, static_cast<std::streamsize>(len));
+        g_fscRawLog.flush();
+        g_fscRawLogBytes += len;
     }
-    constexpr int kMaxFiles = 3;
-    std::string base = rawLogPath();
-    std::error_code ec;
-    std::filesystem::remove(base + "." + std::to_string(kMaxFiles), ec);
-    for (int i = kMaxFiles - 1; i >= 1; --i) {
-        std::string from = base + "." + std::to_string(i);
-        std::string to = base + "." + std::to_string(i + 1);
-        if (std::filesystem::exists(from, ec)) {
-            std::filesystem::rename(from, to, ec);
+}
+
+static std::ofstream openRawLogSegment(const std::string& path) {
+    std::ofstream out;
+    if (g_fscRawLogBinary) {
+        out.open(path, std::ios::trunc | std::ios::binary);
+        if (out.is_open()) {
+            const fsc_raw::FileHeader header = fsc_raw::makeHeader();
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
         }
+    } else {
+        out.open(path, std::ios::trunc);
     }
-    if (std::filesystem::exists(base, ec)) {
-        std::filesystem::rename(base, base + ".1", ec);
+    if (out.is_open()) {
+        preallocateLogSegment(path, kRawLogMaxBytes);
     }
-    g_fscRawLog.open(base, std::ios::trunc);
-    g_fscRawLogBytes = 0;
-    g_fscRawLogStart = std::chrono::steady_clock::now();
+    return out;
+}
+
+static void rawRotateLoop() {
+    std::unique_lock<std::mutex> lock(g_fscRawLogMutex);
+    for (;;) {
+        g_fscRawRotateCv.wait(lock, [] { return g_fscRawRotatePending || g_fscRawRotateStop; });
+        if (!g_fscRawRotatePending) {
+            return;  // stop requested, nothing in flight
+        }
+        std::ofstream retired = std::move(g_fscRawLogRetired);
+        const std::string base = g_fscRawLogPath;
+        lock.unlock();
+
+        const auto t0 = std::chrono::steady_clock::now();
+        retired.close();
+        rotateLogSegments(base, kRawLogMaxFiles);
+        std::ofstream next = openRawLogSegment(base);
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+        lock.lock();
+        g_fscRawLog = std::move(next);
+        g_fscRawLogBytes = g_fscRawLogBinary ? sizeof(fsc_raw::FileHeader) : 0;
+        g_fscRawRotatePending = false;
+        const size_t spilled = g_fscRawLogSpill.size();
+        const uint64_t dropped = g_fscRawLogSpillDropped;
+        g_fscRawLogSpillDropped = 0;
+        if (g_fscRawLog.is_open() && spilled > 0) {
+            // The spill cap is well below the segment size, so this cannot re-trigger rotation.
+            g_fscRawLog.write(g_fscRawLogSpill.data(), static_cast<std::streamsize>(spilled));
+            g_fscRawLog.flush();
+            g_fscRawLogBytes += spilled;
+        }
+        g_fscRawLogSpill.clear();
+        g_fscMetrics.rawLogSpillBytes.set(0);
+        const bool opened = g_fscRawLog.is_open();
+        lock.unlock();
+
+        if (!opened) {
+            logLine("FSC RAW: rotation failed to open " + base);
+        } else {
+            std::ostringstream oss;
+            oss << "FSC RAW: rotated log in " << std::fixed << std::setprecision(1) << ms
+                << " ms (spilled=" << spilled << " bytes";
+            if (dropped > 0) {
+                oss << ", dropped=" << dropped << " writes";
+            }
+            oss << ")";
+            logLine(oss.str());
+        }
+        lock.lock();
+    }
+}
+
+static void startRawRotateThread() {
+    if (g_fscRawRotateThread.joinable()) {
+        return;
+    }
+    g_fscRawRotateStop = false;
+    g_fscRawRotateThread = std::thread(rawRotateLoop);
+}
+
+// Waits for an in-flight rotation to finish, then stops the thread.
+static void stopRawRotateThread() {
+    if (!g_fscRawRotateThread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_fscRawLogMutex);
+        g_fscRawRotateStop = true;
+    }
+    g_fscRawRotateCv.notify_one();
+    g_fscRawRotateThread.join();
+}
+
+// Also re-checks g_fscRawLogActive under the lock, so nothing is buffered
+// after closeRawLog() wrote the tail.
+static bool rawLogWritableLocked() {
+    return g_fscRawLogActive.load() && (g_fscRawLog.is_open() || g_fscRawRotatePending);
+}
+
+static void writeRawBinaryLocked() {
+    if (!rawLogWritableLocked() || g_fscRawBinCount == 0) {
+        return;
+    }
+    const size_t bytes = g_fscRawBinCount * sizeof(fsc_raw::Record);
+    appendRawLogLocked(reinterpret_cast<const char*>(g_fscRawBinBuf.data()), bytes);
+    g_fscRawBinCount = 0;
 }
 
 static void flushRawLogLineLocked(std::chrono::steady_clock::time_point now) {
-    if (!g_fscRawLog.is_open() || g_fscRawLogLineBytes == 0) {
+    if (!rawLogWritableLocked() || g_fscRawLogLineBytes == 0) {
         return;
     }
-    std::ostringstream oss;
     double seconds = std::chrono::duration<double>(g_fscRawLogLineStart - g_fscRawLogStart).count();
     const char* dir = (g_fscRawLogLineDir == RawLogDir::Tx) ? "TX" : "RX";
-    oss << std::fixed << std::setprecision(3) << seconds << " " << dir << ": " << g_fscRawLogLine << "\n";
-    std::string line = oss.str();
-    constexpr size_t kMaxBytes = 5 * 1024 * 1024;
-    if (g_fscRawLogBytes + line.size() > kMaxBytes) {
-        rotateRawLogLocked();
-    }
-    if (g_fscRawLog.is_open()) {
-        g_fscRawLog << line;
-        g_fscRawLog.flush();
-        g_fscRawLogBytes += line.size();
-    }
+    char stamp[48];
+    const int n = std::snprintf(stamp, sizeof(stamp), "%.3f %s: ", std::max(0.0, seconds), dir);
+    g_fscRawLogLine.insert(0, stamp, static_cast<size_t>(std::max(0, n)));
+    g_fscRawLogLine.push_back('\n');
+    appendRawLogLocked(g_fscRawLogLine.data(), g_fscRawLogLine.size());
     g_fscRawLogLine.clear();
     g_fscRawLogLineBytes = 0;
     g_fscRawLogLineDir = RawLogDir::None;
 }
 
+static void closeRawLog();
+
 static void openRawLogFromPrefs() {
+    closeRawLog();
     std::lock_guard<std::mutex> lock(g_fscRawLogMutex);
-    if (g_fscRawLog.is_open()) {
-        flushRawLogLineLocked(std::chrono::steady_clock::now());
-        g_fscRawLog.close();
-    }
-    g_fscRawLogActive.store(false);
+    g_fscRawBinCount = 0;
     g_fscRawLogBytes = 0;
     g_fscRawLogLine.clear();
     g_fscRawLogLineBytes = 0;
@@ -2818,39 +4094,465 @@ static void openRawLogFromPrefs() {
     if (!g_prefs.fsc.rawLog) {
         return;
     }
+    g_fscRawLogBinary = g_prefs.fsc.rawLogBinary;
     std::string logPath = rawLogPath();
+    g_fscRawLogPath = logPath;
     std::error_code ec;
     std::filesystem::create_directories(std::filesystem::path(logPath).parent_path(), ec);
+    g_fscRawLogSpill.clear();
+    g_fscRawLogSpill.reserve(kRawLogSpillMax);
+    g_fscRawLogLine.reserve(256);
+    if (g_fscRawLogBinary) {
+        // Every binary capture starts a fresh segment (the previous one moves to .1).
+        constexpr size_t kBufferRecords = 4096;
+        g_fscRawBinBuf.assign(kBufferRecords, fsc_raw::Record{});
+        g_fscRawLogStart = std::chrono::steady_clock::now();
+        g_fscRawBinLastWrite = g_fscRawLogStart;
+        rotateLogSegments(logPath, kRawLogMaxFiles);
+        g_fscRawLog = openRawLogSegment(logPath);
+        if (!g_fscRawLog.is_open()) {
+            logLine("FSC RAW: failed to open log " + logPath);
+            return;
+        }
+        g_fscRawLogBytes = sizeof(fsc_raw::FileHeader);
+        g_fscRawLogActive.store(true);
+        startRawRotateThread();
+        logLine("FSC RAW: continuous binary capture enabled at " + logPath);
+        return;
+    }
     g_fscRawLog.open(logPath, std::ios::app);
     if (!g_fscRawLog.is_open()) {
         logLine("FSC RAW: failed to open log " + logPath);
         return;
     }
+    preallocateLogSegment(logPath, kRawLogMaxBytes);
     g_fscRawLogStart = std::chrono::steady_clock::now();
     std::error_code sizeEc;
     if (std::filesystem::exists(logPath, sizeEc)) {
         g_fscRawLogBytes = static_cast<size_t>(std::filesystem::file_size(logPath, sizeEc));
     }
     g_fscRawLogActive.store(true);
+    startRawRotateThread();
     logLine("FSC RAW: continuous log enabled at " + logPath);
 }
 
+// Writes the buffered tail first, so a rotation it triggers still lands (with
+// its spill) when the rotation thread stops; then closes the segment and
+// clears the rotation state, so the next open starts clean.
 static void closeRawLog() {
+    {
+        std::lock_guard<std::mutex> lock(g_fscRawLogMutex);
+        flushRawLogLineLocked(std::chrono::steady_clock::now());
+        writeRawBinaryLocked();
+        g_fscRawLogActive.store(false);
+    }
+    stopRawRotateThread();
     std::lock_guard<std::mutex> lock(g_fscRawLogMutex);
     if (g_fscRawLog.is_open()) {
-        flushRawLogLineLocked(std::chrono::steady_clock::now());
         g_fscRawLog.close();
     }
-    g_fscRawLogActive.store(false);
+    if (g_fscRawLogRetired.is_open()) {
+        g_fscRawLogRetired.close();
+    }
+    g_fscRawRotatePending = false;
+    g_fscRawLogSpill.clear();
+    g_fscRawLogSpillDropped = 0;
+    g_fscMetrics.rawLogSpillBytes.set(0);
+}
+
+// Flight recorder (fsc.recorder=1): an always-on in-memory ring with the last
+// seconds of RX/TX bytes and decoded channel values. A trigger freezes the
+// window around the event; once the post-trigger time has passed, a background
+// thread writes it to log/<log name>_rec_<time>_<trigger>.log.
+constexpr uint8_t kFscRecDirState = 3;        // bytes[0]=channel, bytes[1..4]=int32 value
+constexpr size_t kFscRecCapacity = 1u << 17;  // records (16 bytes each), power of two
+constexpr size_t kFscRecMaxDumps = 10;
+constexpr size_t kFscTraceMaxExports = 5;
+constexpr auto kFscRecCooldown = std::chrono::seconds(10);
+
+struct FscRecorder {
+    std::mutex mutex;  // guards everything below
+    std::condition_variable wake;
+    std::thread thread;
+    bool stop = false;
+    uint32_t triggers = 0;
+    int spike = 0;
+    std::chrono::seconds pre{0};
+    std::chrono::seconds post{0};
+    std::string dumpPrefix;  // <log dir>/<log name>_rec_
+    std::chrono::steady_clock::time_point epoch{};
+    std::vector<fsc_raw::Record> ring;
+    size_t head = 0;  // next slot to write
+    size_t size = 0;
+    std::array<int, kFscChannelCount> lastValue{};
+    // Pending trigger
+    bool triggered = false;
+    uint64_t triggerNs = 0;
+    std::chrono::steady_clock::time_point dumpAt{};
+    std::chrono::steady_clock::time_point lastTrigger{};
+    const char* triggerName = "";
+    std::string detail;
+    int merged = 0;
+};
+FscRecorder g_fscRecorder;
+std::atomic<bool> g_fscRecorderActive{false};
+
+// Caller holds g_fscRecorder.mutex.
+static uint64_t fscRecorderNsLocked(std::chrono::steady_clock::time_point now) {
+    if (now < g_fscRecorder.epoch) {
+        return 0;
+    }
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - g_fscRecorder.epoch).count());
+}
+
+// Caller holds g_fscRecorder.mutex. Overwrites the oldest record when full.
+static fsc_raw::Record& fscRecorderNextLocked() {
+    auto& rec = g_fscRecorder.ring[g_fscRecorder.head];
+    g_fscRecorder.head = (g_fscRecorder.head + 1) & (kFscRecCapacity - 1);
+    if (g_fscRecorder.size < kFscRecCapacity) {
+        ++g_fscRecorder.size;
+    }
+    return rec;
+}
+
+static void recordFscBytes(RawLogDir dir, const uint8_t* data, size_t len) {
+    if (!g_fscRecorderActive.load(std::memory_order_relaxed) || data == nullptr || len == 0) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    const uint8_t dirCode = (dir == RawLogDir::Tx) ? fsc_raw::kDirTx : fsc_raw::kDirRx;
+    std::lock_guard<std::mutex> lock(g_fscRecorder.mutex);
+    if (g_fscRecorder.ring.empty()) {
+        return;
+    }
+    const uint64_t ns = fscRecorderNsLocked(now);
+    size_t off = 0;
+    if (g_fscRecorder.size > 0) {
+        // Bytes arriving within 1 ms in the same direction share a record.
+        auto& last = g_fscRecorder.ring[(g_fscRecorder.head - 1) & (kFscRecCapacity - 1)];
+        if (last.dir == dirCode && last.count < fsc_raw::kRecordPayload && ns >= last.timeNs &&
+            ns - last.timeNs < 1000000ull) {
+            off = std::min(len, fsc_raw::kRecordPayload - last.count);
+            std::memcpy(last.bytes + last.count, data, off);
+            last.count = static_cast<uint8_t>(last.count + off);
+        }
+    }
+    while (off < len) {
+        auto& rec = fscRecorderNextLocked();
+        const size_t n = std::min(len - off, fsc_raw::kRecordPayload);
+        rec.timeNs = ns;
+        rec.dir = dirCode;
+        rec.count = static_cast<uint8_t>(n);
+        std::memset(rec.bytes, 0, sizeof(rec.bytes));
+        std::memcpy(rec.bytes, data + off, n);
+        off += n;
+    }
+}
+
+static void triggerFscRecorder(uint32_t trigger, const std::string& detail) {
+    if (!g_fscRecorderActive.load(std::memory_order_relaxed)) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    const char* name = "";
+    int postSec = 0;
+    {
+        std::lock_guard<std::mutex> lock(g_fscRecorder.mutex);
+        if (!(g_fscRecorder.triggers & trigger) || g_fscRecorder.ring.empty()) {
+            return;
+        }
+        if (g_fscRecorder.triggered) {
+            ++g_fscRecorder.merged;  // falls inside the window already being recorded
+            return;
+        }
+        if (trigger != kFscRecCommand && g_fscRecorder.lastTrigger.time_since_epoch().count() != 0 &&
+            now - g_fscRecorder.lastTrigger < kFscRecCooldown) {
+            return;
+        }
+        for (size_t i = 0; i < kFscRecTriggerCount; ++i) {
+            if (trigger == (1u << i)) {
+                name = kFscRecTriggerNames[i];
+            }
+        }
+        g_fscRecorder.triggered = true;
+        g_fscRecorder.triggerNs = fscRecorderNsLocked(now);
+        g_fscRecorder.dumpAt = now + g_fscRecorder.post;
+        g_fscRecorder.lastTrigger = now;
+        g_fscRecorder.triggerName = name;
+        g_fscRecorder.detail = detail;
+        g_fscRecorder.merged = 0;
+        postSec = static_cast<int>(g_fscRecorder.post.count());
+    }
+    g_fscRecorder.wake.notify_one();
+    logLine(std::string("FSC REC: trigger ") + name + (detail.empty() ? "" : " (" + detail + ")") +
+            ", dump in " + std::to_string(postSec) + " s");
+}
+
+// Called from markFscChannelLocked() for every decoded channel update; only
+// changes are recorded. Axis jumps of at least fsc.recorder_spike counts fire
+// the spike trigger.
+static void recordFscChannelSample(FscChannel ch, int value, std::chrono::steady_clock::time_point now) {
+    if (!g_fscRecorderActive.load(std::memory_order_relaxed)) {
+        return;
+    }
+    const size_t i = static_cast<size_t>(ch);
+    int prev = -1;
+    bool spike = false;
+    {
+        std::lock_guard<std::mutex> lock(g_fscRecorder.mutex);
+        if (g_fscRecorder.ring.empty() || g_fscRecorder.lastValue[i] == value) {
+            return;
+        }
+        prev = g_fscRecorder.lastValue[i];
+        g_fscRecorder.lastValue[i] = value;
+        auto& rec = fscRecorderNextLocked();
+        rec.timeNs = fscRecorderNsLocked(now);
+        rec.dir = kFscRecDirState;
+        rec.count = 5;
+        std::memset(rec.bytes, 0, sizeof(rec.bytes));
+        rec.bytes[0] = static_cast<uint8_t>(i);
+        const int32_t v = value;
+        std::memcpy(rec.bytes + 1, &v, sizeof(v));
+        switch (ch) {
+            case FscChannel::Reverser1:
+            case FscChannel::Reverser2:
+            case FscChannel::Throttle1:
+            case FscChannel::Throttle2:
+            case FscChannel::Speedbrake:
+                spike = prev >= 0 && value >= 0 && std::abs(value - prev) >= g_fscRecorder.spike;
+                break;
+            default:
+                break;
+        }
+    }
+    if (spike) {
+        triggerFscRecorder(kFscRecSpike, std::string(kFscChannelNames[i]) + " " + std::to_string(prev) +
+                                             " -> " + std::to_string(value));
+    }
+}
+
+// Local time with milliseconds (20250101-123456-789): a recorder dump on the
+// command can follow another within the same second.
+static std::string dumpFileStamp() {
+    const auto now = std::chrono::system_clock::now();
+    std::time_t t = std::chrono::system_clock::to_time_t(now);
+    std::tm tm{};
+#if IBM
+    localtime_s(&tm, &t);
+#else
+    localtime_r(&t, &tm);
+#endif
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000;
+    char buf[32];
+    const size_t n = std::strftime(buf, sizeof(buf), "%Y%m%d-%H%M%S", &tm);
+    std::snprintf(buf + n, sizeof(buf) - n, "-%03d", static_cast<int>(ms));
+    return buf;
+}
+
+// <log dir>/<log name without extension>_<kind>_ (dump files get a timestamp appended).
+static std::string dumpFilePrefix(const char* kind) {
+    std::string base = g_prefs.logfileName.empty() ? std::string(PLUGIN_LOG_NAME) : g_prefs.logfileName;
+    const auto dot = base.rfind('.');
+    if (dot != std::string::npos) {
+        base.resize(dot);
+    }
+    const std::string dir = makePluginPath("Resources/plugins/" + std::string(PLUGIN_DIR) + "/log/");
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    return dir + base + "_" + kind + "_";
+}
+
+// Keeps the newest |keep| files starting with |prefix| (names sort by timestamp).
+static void pruneDumpFiles(const std::string& prefix, size_t keep) {
+    const std::filesystem::path base(prefix);
+    const std::string stem = base.filename().string();
+    std::error_code ec;
+    std::vector<std::filesystem::path> dumps;
+    for (const auto& entry : std::filesystem::directory_iterator(base.parent_path(), ec)) {
+        const std::string name = entry.path().filename().string();
+        if (name.compare(0, stem.size(), stem) == 0) {
+            dumps.push_back(entry.path());
+        }
+    }
+    if (dumps.size() <= keep) {
+        return;
+    }
+    std::sort(dumps.begin(), dumps.end());
+    for (size_t i = 0; i + keep < dumps.size(); ++i) {
+        std::filesystem::remove(dumps[i], ec);
+    }
+}
+
+static bool writeFscRecorderDump(const std::string& path, const std::vector<fsc_raw::Record>& window,
+                                 uint64_t fromNs, uint64_t triggerNs, const std::string& reason,
+                                 bool truncated, int merged) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+    char buf[128];
+    out << "# " << PLUGIN_NAME << " flight recorder dump\n";
+    out << "# trigger: " << reason << "\n";
+    std::snprintf(buf, sizeof(buf), "# trigger at %.3f s; records=%zu", static_cast<double>(triggerNs - fromNs) / 1e9,
+                  window.size());
+    out << buf;
+    if (merged > 0) {
+        out << "; later triggers in window=" << merged;
+    }
+    if (truncated) {
+        out << "; ring full, history shortened";
+    }
+    out << "\n# RX/TX: serial bytes, ST: decoded channel value\n";
+    fsc_raw::TextLineBuilder builder;
+    std::string line;
+    for (const auto& rec : window) {
+        const uint64_t t = rec.timeNs - fromNs;
+        if (rec.dir == kFscRecDirState) {
+            if (builder.finish(line)) {
+                out << line;
+            }
+            int32_t v = 0;
+            std::memcpy(&v, rec.bytes + 1, sizeof(v));
+            const char* name = rec.bytes[0] < kFscChannelCount ? kFscChannelNames[rec.bytes[0]] : "?";
+            std::snprintf(buf, sizeof(buf), "%.3f ST: %s=%d\n", static_cast<double>(t) / 1e9, name, v);
+            out << buf;
+            continue;
+        }
+        for (size_t b = 0; b < rec.count && b < fsc_raw::kRecordPayload; ++b) {
+            if (builder.add(t, rec.dir, rec.bytes[b], line)) {
+                out << line;
+            }
+        }
+    }
+    if (builder.finish(line)) {
+        out << line;
+    }
+    return static_cast<bool>(out);
+}
+
+static void fscRecorderLoop() {
+    std::vector<fsc_raw::Record> window;
+    window.reserve(kFscRecCapacity);
+    std::unique_lock<std::mutex> lock(g_fscRecorder.mutex);
+    for (;;) {
+        g_fscRecorder.wake.wait(lock, [] { return g_fscRecorder.stop || g_fscRecorder.triggered; });
+        if (!g_fscRecorder.triggered) {
+            return;
+        }
+        // Collect the post-trigger part (stop dumps what is there right away).
+        g_fscRecorder.wake.wait_until(lock, g_fscRecorder.dumpAt, [] { return g_fscRecorder.stop; });
+
+        // Copy the ring oldest-first in at most two blocks; filtering happens unlocked.
+        const size_t size = g_fscRecorder.size;
+        const size_t first = (g_fscRecorder.head - size) & (kFscRecCapacity - 1);
+        const size_t firstLen = std::min(size, kFscRecCapacity - first);
+        window.assign(g_fscRecorder.ring.begin() + static_cast<std::ptrdiff_t>(first),
+                      g_fscRecorder.ring.begin() + static_cast<std::ptrdiff_t>(first + firstLen));
+        window.insert(window.end(), g_fscRecorder.ring.begin(),
+                      g_fscRecorder.ring.begin() + static_cast<std::ptrdiff_t>(size - firstLen));
+        const uint64_t triggerNs = g_fscRecorder.triggerNs;
+        const uint64_t preNs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(g_fscRecorder.pre).count());
+        const std::string name = g_fscRecorder.triggerName;
+        const std::string reason = name + (g_fscRecorder.detail.empty() ? "" : " (" + g_fscRecorder.detail + ")");
+        const std::string prefix = g_fscRecorder.dumpPrefix;
+        const int merged = g_fscRecorder.merged;
+        g_fscRecorder.triggered = false;
+        lock.unlock();
+
+        const uint64_t fromNs = triggerNs > preNs ? triggerNs - preNs : 0;
+        const bool truncated = size == kFscRecCapacity && !window.empty() && window.front().timeNs > fromNs;
+        window.erase(window.begin(),
+                     std::find_if(window.begin(), window.end(),
+                                  [fromNs](const fsc_raw::Record& r) { return r.timeNs >= fromNs; }));
+        const std::string path = prefix + dumpFileStamp() + "_" + name + ".log";
+        if (writeFscRecorderDump(path, window, fromNs, triggerNs, reason, truncated, merged)) {
+            pruneDumpFiles(prefix, kFscRecMaxDumps);
+            logLine("FSC REC: wrote " + std::to_string(window.size()) + " records to " + path);
+        } else {
+            logLine("FSC REC: failed to write " + path);
+        }
+        lock.lock();
+    }
+}
+
+// Stops the dump thread; a pending trigger is written first.
+static void stopFscRecorder() {
+    g_fscRecorderActive.store(false);
+    if (g_fscRecorder.thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(g_fscRecorder.mutex);
+            g_fscRecorder.stop = true;
+        }
+        g_fscRecorder.wake.notify_one();
+        g_fscRecorder.thread.join();
+    }
+    std::lock_guard<std::mutex> lock(g_fscRecorder.mutex);
+    g_fscRecorder.ring.clear();
+    g_fscRecorder.ring.shrink_to_fit();
+    g_fscRecorder.size = 0;
+    g_fscRecorder.head = 0;
+    g_fscRecorder.triggered = false;
+}
+
+static void openFscRecorderFromPrefs() {
+    stopFscRecorder();
+    const auto& prefs = g_prefs.fsc.recorder;
+    if (!prefs.enabled) {
+        return;
+    }
+    const std::string dumpPrefix = dumpFilePrefix("rec");
+    {
+        std::lock_guard<std::mutex> lock(g_fscRecorder.mutex);
+        g_fscRecorder.ring.assign(kFscRecCapacity, fsc_raw::Record{});
+        g_fscRecorder.head = 0;
+        g_fscRecorder.size = 0;
+        g_fscRecorder.lastValue.fill(-1);
+        g_fscRecorder.epoch = std::chrono::steady_clock::now();
+        g_fscRecorder.lastTrigger = {};
+        g_fscRecorder.triggers = prefs.triggers;
+        g_fscRecorder.spike = prefs.spike;
+        g_fscRecorder.pre = std::chrono::seconds(prefs.preSec);
+        g_fscRecorder.post = std::chrono::seconds(prefs.postSec);
+        g_fscRecorder.dumpPrefix = dumpPrefix;
+        g_fscRecorder.stop = false;
+    }
+    g_fscRecorder.thread = std::thread(fscRecorderLoop);
+    g_fscRecorderActive.store(true);
 }
 
 static void logFscRawBytes(RawLogDir dir, const uint8_t* data, size_t len) {
+    recordFscBytes(dir, data, len);
+    (dir == RawLogDir::Tx ? g_fscMetrics.txBytes : g_fscMetrics.rxBytes).add(len);
     if (!g_fscRawLogActive.load() || data == nullptr || len == 0) {
         return;
     }
     auto now = std::chrono::steady_clock::now();
     std::lock_guard<std::mutex> lock(g_fscRawLogMutex);
-    if (!g_fscRawLog.is_open()) {
+    if (!rawLogWritableLocked()) {
+        return;
+    }
+    if (g_fscRawLogBinary) {
+        const uint64_t ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now - g_fscRawLogStart).count());
+        const uint8_t dirCode = (dir == RawLogDir::Tx) ? fsc_raw::kDirTx : fsc_raw::kDirRx;
+        for (size_t off = 0; off < len; off += fsc_raw::kRecordPayload) {
+            if (g_fscRawBinCount == g_fscRawBinBuf.size()) {
+                writeRawBinaryLocked();
+            }
+            auto& rec = g_fscRawBinBuf[g_fscRawBinCount++];
+            const size_t n = std::min(len - off, fsc_raw::kRecordPayload);
+            rec.timeNs = ns;
+            rec.dir = dirCode;
+            rec.count = static_cast<uint8_t>(n);
+            std::memset(rec.bytes, 0, sizeof(rec.bytes));
+            std::memcpy(rec.bytes, data + off, n);
+        }
+        if (now - g_fscRawBinLastWrite >= std::chrono::seconds(1)) {
+            writeRawBinaryLocked();
+            g_fscRawBinLastWrite = now;
+        }
         return;
     }
     constexpr int kLineBytesMax = 32;
@@ -2868,7 +4570,7 @@ static void logFscRawBytes(RawLogDir dir, const uint8_t* data, size_t len) {
         if (!g_fscRawLogLine.empty()) {
             g_fscRawLogLine.push_back(' ');
         }
-        g_fscRawLogLine += hexByte(data[i]);
+        fsc_raw::appendHexByte(g_fscRawLogLine, data[i]);
         ++g_fscRawLogLineBytes;
         if (g_fscRawLogLineBytes >= kLineBytesMax) {
             flushRawLogLineLocked(now);
@@ -2881,7 +4583,15 @@ static void maybeFlushRawLog(std::chrono::steady_clock::time_point now, bool for
         return;
     }
     std::lock_guard<std::mutex> lock(g_fscRawLogMutex);
-    if (!g_fscRawLog.is_open()) {
+    if (!rawLogWritableLocked()) {
+        return;
+    }
+    if (g_fscRawLogBinary) {
+        constexpr auto kWriteInterval = std::chrono::seconds(1);
+        if (force || now - g_fscRawBinLastWrite >= kWriteInterval) {
+            writeRawBinaryLocked();
+            g_fscRawBinLastWrite = now;
+        }
         return;
     }
     if (force) {
@@ -2894,6 +4604,39 @@ static void maybeFlushRawLog(std::chrono::steady_clock::time_point now, bool for
     }
 }
 
+static FscBindingCache::CommandEntry& lookupCommandPath(const std::string& path) {
+    auto& entry = g_fscBindingCache.commands[path];
+    if (entry.cmd) {
+        ++g_fscBindingCache.hits;
+        return entry;
+    }
+    if (entry.probedPass == g_fscBindingCache.pass) {
+        return entry;
+    }
+    entry.probedPass = g_fscBindingCache.pass;
+    entry.cmd = XPLMFindCommand(path.c_str());
+    ++g_fscBindingCache.lookups;
+    return entry;
+}
+
+static FscBindingCache::DatarefEntry& lookupDatarefPath(const std::string& path) {
+    auto& entry = g_fscBindingCache.datarefs[path];
+    if (entry.dataref) {
+        ++g_fscBindingCache.hits;
+        return entry;
+    }
+    if (entry.probedPass == g_fscBindingCache.pass) {
+        return entry;
+    }
+    entry.probedPass = g_fscBindingCache.pass;
+    entry.dataref = XPLMFindDataRef(path.c_str());
+    ++g_fscBindingCache.lookups;
+    if (entry.dataref) {
+        entry.types = XPLMGetDataRefTypes(entry.dataref);
+    }
+    return entry;
+}
+
 static bool bindCommandPath(const std::string& path,
                             XPLMCommandRef& out,
                             bool logMissing,
@@ -2906,7 +4649,7 @@ static bool bindCommandPath(const std::string& path,
         missing = true;
         return false;
     }
-    out = XPLMFindCommand(path.c_str());
+    out = lookupCommandPath(path).cmd;
     if (!out) {
         if (logMissing) {
             logLine("FSC: command not found for " + ctx + ": " + path);
@@ -2930,7 +4673,8 @@ static bool bindDatarefPath(const std::string& path,
         missing = true;
         return false;
     }
-    out = XPLMFindDataRef(path.c_str());
+    const auto& entry = lookupDatarefPath(path);
+    out = entry.dataref;
     if (!out) {
         if (logMissing) {
             logLine("FSC: dataref not found for " + ctx + ": " + path);
@@ -2938,7 +4682,7 @@ static bool bindDatarefPath(const std::string& path,
         missing = true;
         return false;
     }
-    outType = XPLMGetDataRefTypes(out);
+    outType = entry.types;
     return true;
 }
 
@@ -3007,8 +4751,37 @@ static void bindActions(std::vector<FscAction>& actions,
     }
 }
 
+static void logFscBindingCacheSummary(std::chrono::steady_clock::duration elapsed) {
+    int cmdResolved = 0;
+    for (const auto& kv : g_fscBindingCache.commands) {
+        if (kv.second.cmd) {
+            ++cmdResolved;
+        }
+    }
+    int drefResolved = 0;
+    for (const auto& kv : g_fscBindingCache.datarefs) {
+        if (kv.second.dataref) {
+            ++drefResolved;
+        }
+    }
+    const double ms = std::chrono::duration<double, std::milli>(elapsed).count();
+    std::ostringstream oss;
+    oss << "FSC: bindings pass " << g_fscBindingCache.pass
+        << ": datarefs " << drefResolved << "/" << g_fscBindingCache.datarefs.size()
+        << ", commands " << cmdResolved << "/" << g_fscBindingCache.commands.size()
+        << ", lookups=" << g_fscBindingCache.lookups
+        << " (total " << g_fscBindingCache.totalLookups << ")"
+        << ", cached=" << g_fscBindingCache.hits
+        << ", time=" << std::fixed << std::setprecision(2) << ms << " ms";
+    logLine(oss.str());
+}
+
 static bool resolveFscProfileBindings(bool logMissing, bool& missingRefs) {
     missingRefs = false;
+    const auto started = std::chrono::steady_clock::now();
+    ++g_fscBindingCache.pass;
+    g_fscBindingCache.lookups = 0;
+    g_fscBindingCache.hits = 0;
 
     for (auto& mapping : g_fscProfileRuntime.axes) {
         if (!mapping.defined) {
@@ -3016,6 +4789,9 @@ static bool resolveFscProfileBindings(bool logMissing, bool& missingRefs) {
         }
         requirePrefIntRef(mapping.sourceRefMin, "axis source_ref_min", logMissing, missingRefs);
         requirePrefIntRef(mapping.sourceRefMax, "axis source_ref_max", logMissing, missingRefs);
+        for (const auto& ref : mapping.predict.detentRefs) {
+            requirePrefIntRef(ref, "axis predict detent_ref", logMissing, missingRefs);
+        }
         if (!mapping.invertRef.empty()) {
             requirePrefBoolRef(mapping.invertRef, "axis invert_ref", logMissing, missingRefs);
         }
@@ -3115,6 +4891,9 @@ static bool resolveFscProfileBindings(bool logMissing, bool& missingRefs) {
                         motor.speedbrake.ratioDatarefType, logMissing, "motor speedbrake ratio_dataref", missingRefs);
         requirePrefIntRef(motor.speedbrake.armRef, "motor speedbrake arm_ref", logMissing, missingRefs);
         requirePrefIntRef(motor.speedbrake.upRef, "motor speedbrake up_ref", logMissing, missingRefs);
+        if (!motor.speedbrake.downRef.empty()) {
+            requirePrefIntRef(motor.speedbrake.downRef, "motor speedbrake down_ref", logMissing, missingRefs);
+        }
         requirePrefIntRef(motor.speedbrake.motorDownRef, "motor speedbrake motor_down_ref", logMissing, missingRefs);
         requirePrefIntRef(motor.speedbrake.motorUpRef, "motor speedbrake motor_up_ref", logMissing, missingRefs);
 
@@ -3142,20 +4921,63 @@ static bool resolveFscProfileBindings(bool logMissing, bool& missingRefs) {
                         logMissing, "motor right_toe_brake_dataref", missingRefs);
     }
 
+    g_fscBindingCache.totalLookups += g_fscBindingCache.lookups;
+    logFscBindingCacheSummary(std::chrono::steady_clock::now() - started);
     return !missingRefs;
 }
 
-static void scheduleFscDeferredInit(std::chrono::seconds delay) {
+static void startFscDeferredInit() {
+    g_fscDeferredInit = DeferredInit{};
     g_fscDeferredInit.pending = true;
-    g_fscDeferredInit.due = std::chrono::steady_clock::now() + delay;
-    g_fscDeferredInit.attempts = 0;
+    g_fscDeferredInit.started = std::chrono::steady_clock::now();
 }
 
-static bool refreshFscProfile(bool logMissing) {
+static void collectFscUnresolvedBindings() {
+    auto& unresolved = g_fscDeferredInit.unresolved;
+    unresolved.clear();
+    g_fscDeferredInit.cursor = 0;
+    for (const auto& kv : g_fscBindingCache.datarefs) {
+        if (!kv.second.dataref) {
+            unresolved.push_back({false, kv.first});
+        }
+    }
+    for (const auto& kv : g_fscBindingCache.commands) {
+        if (!kv.second.cmd) {
+            unresolved.push_back({true, kv.first});
+        }
+    }
+}
+
+static void rememberFscBoundAircraft() {
+    g_fscBoundTailnum = readTailnum();
+    g_fscBoundAcfPath = readAcfPath();
+}
+
+static bool isFscBoundAircraftCurrent() {
+    if (!g_fscProfileActive.load() || g_fscBoundTailnum.empty()) {
+        return false;
+    }
+    return readTailnum() == g_fscBoundTailnum && readAcfPath() == g_fscBoundAcfPath;
+}
+
+static void resetFscProfileRuntime() {
     g_fscProfileActive.store(false);
+    g_fscBoundTailnum.clear();
+    g_fscBoundAcfPath.clear();
     g_fscProfileId.clear();
     g_fscProfilePath.clear();
     g_fscProfileRuntime = FscProfileRuntime{};
+    configureFscMotion();
+    configureFscFilters();
+    {
+        std::lock_guard<std::mutex> lock(g_fscOutputMutex);
+        const bool motorsDriven = g_fscOutputIntent.motorPower >= 0;
+        g_fscOutputIntent = FscHwOutputs{};
+        if (motorsDriven) {
+            g_fscOutputIntent.motorPower = 0;  // profile gone: leave the motors off
+        }
+    }
+    g_fscBindingCache = FscBindingCache{};
     for (auto& s : g_fscSwitchState) {
         s.known = false;
         s.value = false;
@@ -3166,16 +4988,31 @@ static bool refreshFscProfile(bool logMissing) {
     g_fscAxisResyncSecondPending.store(false);
     g_fscAxisResyncSecondDue = std::chrono::steady_clock::time_point{};
     g_fscDeferredInit.pending = false;
+}
 
-    if (!g_fscProfileValid.load()) {
-        return false;
+static void activateFscProfile() {
+    g_fscProfileActive.store(true);
+    rememberFscBoundAircraft();
+    if (g_fscProfileRuntime.sync.resyncOnAircraftLoaded) {
+        g_fscResyncPending.store(true);
+        scheduleFscAxisResync();
     }
+    g_fscLastResync = std::chrono::steady_clock::now();
+    configureFscMotion();
+    configureFscFilters();
+    logLine("FSC: active profile '" + g_fscProfileRuntime.profileId + "' (" + g_fscProfileRuntime.name + ")");
+}
 
-    const std::string tail = readTailnum();
+enum class FscSelectResult {
+    NoTailnum,
+    NoMatch,
+    Waiting,
+    Active
+};
+
+static FscSelectResult selectFscProfile(const std::string& tail, bool logMissing) {
     if (tail.empty()) {
-        logLine("FSC: tailnum not available, profile selection deferred.");
-        scheduleFscDeferredInit(std::chrono::seconds(5));
-        return false;
+        return FscSelectResult::NoTailnum;
     }
 
     const FscProfileRecord* match = nullptr;
@@ -3193,7 +5030,7 @@ static bool refreshFscProfile(bool logMissing) {
 
     if (!match) {
         logLine("FSC: no profile matched tailnum '" + tail + "'");
-        return false;
+        return FscSelectResult::NoMatch;
     }
 
     g_fscProfileRuntime = match->runtime;
@@ -3204,22 +5041,37 @@ static bool refreshFscProfile(bool logMissing) {
     bool ready = resolveFscProfileBindings(logMissing, missingRefs);
     if (!ready && g_fscProfileRuntime.sync.deferUntilDatarefs) {
         logLine("FSC: profile '" + g_fscProfileId + "' waiting for datarefs/commands; deferring init.");
-        scheduleFscDeferredInit(std::chrono::seconds(g_fscProfileRuntime.sync.startupDelaySec));
-        return false;
+        collectFscUnresolvedBindings();
+        return FscSelectResult::Waiting;
     }
 
     if (missingRefs && logMissing) {
         logLine("FSC: profile '" + g_fscProfileId + "' active with missing bindings.");
     }
 
-    g_fscProfileActive.store(true);
-    if (g_fscProfileRuntime.sync.resyncOnAircraftLoaded) {
-        g_fscResyncPending.store(true);
-        scheduleFscAxisResync();
+    activateFscProfile();
+    return FscSelectResult::Active;
+}
+
+static bool refreshFscProfile(bool logMissing) {
+    resetFscProfileRuntime();
+
+    if (!g_fscProfileValid.load()) {
+        return false;
     }
-    g_fscLastResync = std::chrono::steady_clock::now();
-    logLine("FSC: active profile '" + g_fscProfileRuntime.profileId + "' (" + g_fscProfileRuntime.name + ")");
-    return true;
+
+    const std::string tail = readTailnum();
+    if (tail.empty()) {
+        logLine("FSC: tailnum not available, profile selection deferred.");
+    }
+    startFscDeferredInit();
+    g_fscDeferredInit.lastTail = tail;
+    const FscSelectResult result = selectFscProfile(tail, logMissing);
+    if (result == FscSelectResult::Active) {
+        g_fscDeferredInit.pending = false;
+        return true;
+    }
+    return false;
 }
 
 static XPWidgetID createCaption(int left, int top, int right, int bottom, const char* text, XPWidgetID container) {
@@ -3590,7 +5442,7 @@ static void ensureFscWindow() {
     int l = 0, t = 0, r = 0, b = 0;
     XPLMGetScreenBoundsGlobal(&l, &t, &r, &b);
     const int width = 820;
-    const int height = 870;
+    const int height = 926;
     const int left = l + 80;
     const int top = t - 80;
     const int right = left + width;
@@ -3802,6 +5654,14 @@ static void ensureFscWindow() {
     y -= (rowHeight + rowGap);
 
     g_fscCalibStatus = createCaption(labelX, y, contentRight, y - rowHeight, g_fscCalibStatusText.c_str(), g_fscWindow);
+    y -= (rowHeight + rowGap);
+
+    g_fscHealthStatus = createCaption(labelX, y, contentRight, y - rowHeight, "Inputs: not connected", g_fscWindow);
+    y -= (rowHeight + rowGap);
+
+    g_fscProfileStatus = createCaption(labelX, y, contentRight, y - rowHeight,
+                                       g_prefs.fsc.profiler ? "Frame: no samples yet" : "Frame: profiler off (fsc.profiler=0)",
+                                       g_fscWindow);
 
     int bx = btnLeft;
     int by = top - 55;
@@ -3872,6 +5732,8 @@ static void destroyFscWindow() {
     g_fscFieldMotorTrimWheel17 = nullptr;
     g_fscFieldMotorThrottleRate = nullptr;
     g_fscCalibStatus = nullptr;
+    g_fscHealthStatus = nullptr;
+    g_fscProfileStatus = nullptr;
     g_fscBtnSaveApply = nullptr;
     g_fscBtnReload = nullptr;
     g_fscBtnCalibStart = nullptr;
@@ -3909,6 +5771,11 @@ static void createPluginMenu() {
     XPLMAppendMenuItem(g_menuId, "Calibration: Start", g_cmdFscCalibStart, 1);
     XPLMAppendMenuItem(g_menuId, "Calibration: Next", g_cmdFscCalibNext, 1);
     XPLMAppendMenuItem(g_menuId, "Calibration: Cancel", g_cmdFscCalibCancel, 1);
+    XPLMAppendMenuItem(g_menuId, "Flight recorder: Dump", g_cmdRecorderDump, 1);
+    XPLMAppendMenuItem(g_menuId, "Profiler: Dump", g_cmdProfilerDump, 1);
+    XPLMAppendMenuItem(g_menuId, "Trace: Export", g_cmdTraceExport, 1);
+    XPLMAppendMenuItem(g_menuId, "Serial link: Report", g_cmdLinkReport, 1);
+    XPLMAppendMenuItem(g_menuId, "Serial link: Census", g_cmdCensus, 1);
 }
 
 static void destroyPluginMenu() {
@@ -4047,8 +5914,36 @@ static void logFscSettings() {
             ", throttle_smooth_ms=" + std::to_string(g_prefs.fsc.throttleSmoothMs) +
             ", throttle_deadband=" + std::to_string(g_prefs.fsc.throttleDeadband) +
             ", throttle_sync_band=" + std::to_string(g_prefs.fsc.throttleSyncBand) +
+            ", stale_ms=" + std::to_string(g_prefs.fsc.staleMs) +
+            ", stale_action=" + fscStaleActionToString(g_prefs.fsc.staleAction) +
             ", debug=" + std::string(g_prefs.fsc.debug ? "1" : "0") +
-            ", raw_log=" + std::string(g_prefs.fsc.rawLog ? "1" : "0"));
+            ", raw_log=" + std::string(g_prefs.fsc.rawLog ? "1" : "0") +
+            ", raw_log_format=" + std::string(g_prefs.fsc.rawLogBinary ? "binary" : "text") +
+            ", recorder=" + std::string(g_prefs.fsc.recorder.enabled ? "1" : "0") +
+            ", recorder_window=" + std::to_string(g_prefs.fsc.recorder.preSec) + "+" +
+            std::to_string(g_prefs.fsc.recorder.postSec) + "s" +
+            ", recorder_triggers=" + fscRecorderTriggersToString(g_prefs.fsc.recorder.triggers) +
+            ", recorder_spike=" + std::to_string(g_prefs.fsc.recorder.spike) +
+            ", profiler=" + std::string(g_prefs.fsc.profiler ? "1" : "0") +
+            ", profiler_budget_us=" + std::to_string(g_prefs.fsc.profilerBudgetUs) +
+            ", trace=" + std::string(g_prefs.fsc.trace ? "1" : "0") +
+            ", link_report_sec=" + std::to_string(g_prefs.fsc.linkReportSec) +
+            ", link_gap_ms=" + std::to_string(g_prefs.fsc.linkGapMs) +
+            ", output_period_ms=" + std::to_string(g_prefs.fsc.outputPeriodMs) +
+            ", tx_budget_pct=" + std::to_string(g_prefs.fsc.txBudgetPct) +
+            ", max_motors=" + std::to_string(g_prefs.fsc.maxMotors) +
+            ", motor_duty=" + std::to_string(g_prefs.fsc.motorDutyPct) + "%/" +
+            std::to_string(g_prefs.fsc.motorDutyWindowSec) + "s");
+}
+
+static void finishFscDeferredInit(const char* what) {
+    const auto now = std::chrono::steady_clock::now();
+    const long long ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - g_fscDeferredInit.started).count();
+    logLine(std::string("FSC deferred init: ") + what + " after " + std::to_string(ms) + " ms (" +
+            std::to_string(g_fscDeferredInit.frames) + " frames, " +
+            std::to_string(g_fscDeferredInit.probes) + " probes)");
+    g_fscDeferredInit.pending = false;
+    g_fscDeferredInit.unresolved.clear();
 }
 
 static void maybeRunFscDeferredInit() {
@@ -4056,116 +5951,334 @@ static void maybeRunFscDeferredInit() {
         return;
     }
 
-    const auto now = std::chrono::steady_clock::now();
-    if (now < g_fscDeferredInit.due) {
-        return;
-    }
-
-    constexpr int kMaxAttempts = 20;
-    constexpr auto kRetryDelay = std::chrono::seconds(5);
+    constexpr auto kFrameBudget = std::chrono::microseconds(250);
+    constexpr auto kGiveUpAfter = std::chrono::seconds(120);
 
     if (!g_fscProfileValid.load()) {
         g_fscDeferredInit.pending = false;
         return;
     }
 
+    const auto now = std::chrono::steady_clock::now();
+    ++g_fscDeferredInit.frames;
+    if (now - g_fscDeferredInit.started >= kGiveUpAfter) {
+        finishFscDeferredInit(g_fscProfileId.empty() ? "no profile match, giving up"
+                                                     : "bindings still missing, giving up");
+        return;
+    }
+
     if (g_fscProfileId.empty()) {
-        if (refreshFscProfile(true)) {
-            updateFscLifecycle("fsc deferred select");
-            g_fscDeferredInit.pending = false;
-            g_fscDeferredInit.attempts = 0;
+        // Only re-run selection when the tailnum appears or changes.
+        const std::string tail = readTailnum();
+        if (tail.empty() || tail == g_fscDeferredInit.lastTail) {
             return;
         }
-        if (++g_fscDeferredInit.attempts >= kMaxAttempts) {
-            g_fscDeferredInit.pending = false;
-            logLine("FSC deferred init: no profile match, giving up.");
-            return;
+        g_fscDeferredInit.lastTail = tail;
+        const FscSelectResult result = selectFscProfile(tail, true);
+        if (result == FscSelectResult::Active) {
+            finishFscDeferredInit("profile active");
+            updateFscLifecycle("fsc deferred select");
         }
-        g_fscDeferredInit.due = now + kRetryDelay;
         return;
     }
 
+    auto& unresolved = g_fscDeferredInit.unresolved;
+    while (!unresolved.empty()) {
+        if (g_fscDeferredInit.cursor >= unresolved.size()) {
+            g_fscDeferredInit.cursor = 0;
+        }
+        const auto& entry = unresolved[g_fscDeferredInit.cursor];
+        bool found = false;
+        if (entry.command) {
+            auto& cached = g_fscBindingCache.commands[entry.path];
+            cached.cmd = XPLMFindCommand(entry.path.c_str());
+            found = cached.cmd != nullptr;
+        } else {
+            auto& cached = g_fscBindingCache.datarefs[entry.path];
+            cached.dataref = XPLMFindDataRef(entry.path.c_str());
+            if (cached.dataref) {
+                cached.types = XPLMGetDataRefTypes(cached.dataref);
+                found = true;
+            }
+        }
+        ++g_fscDeferredInit.probes;
+        ++g_fscBindingCache.totalLookups;
+        if (found) {
+            if (g_fscDeferredInit.cursor + 1 < unresolved.size()) {
+                unresolved[g_fscDeferredInit.cursor] = std::move(unresolved.back());
+            }
+            unresolved.pop_back();
+        } else {
+            ++g_fscDeferredInit.cursor;
+        }
+        if (std::chrono::steady_clock::now() - now >= kFrameBudget) {
+            return;
+        }
+        if (!unresolved.empty() && g_fscDeferredInit.cursor >= unresolved.size()) {
+            return;  // full sweep done this frame, still waiting
+        }
+    }
+
+    // Every XPLM path exists now; the final pass is served from the cache.
     bool missingRefs = false;
     bool ready = resolveFscProfileBindings(true, missingRefs);
-    if (ready || !g_fscProfileRuntime.sync.deferUntilDatarefs) {
-        g_fscProfileActive.store(true);
-        if (g_fscProfileRuntime.sync.resyncOnAircraftLoaded) {
-            g_fscResyncPending.store(true);
-            scheduleFscAxisResync();
+    if (!ready) {
+        finishFscDeferredInit("bindings have profile errors, giving up");
+        return;
+    }
+    activateFscProfile();
+    finishFscDeferredInit("profile active");
+    updateFscLifecycle("fsc deferred init");
+}
+
+// Flight-loop profiler (fsc.profiler=1). Each stage of the frame is timed by
+// a scoped timer into an HDR-style log-linear histogram: 16 linear
+// sub-buckets per power of two (<= 6.25 % error) from 1 ns to ~4 s. Sim
+// thread only, so no locking; when disabled a timer costs one bool test.
+enum class FscStage {
+    DeferredInit,
+    Snapshot,
+    Health,
+    Calibration,
+    Resync,
+    Outputs,
+    StalePolicy,
+    State,
+    Frame,
+    Count,
+};
+constexpr size_t kFscStageCount = static_cast<size_t>(FscStage::Count);
+const char* const kFscStageNames[kFscStageCount] = {
+    "deferred_init", "snapshot", "health", "calibration", "resync", "outputs", "stale_policy", "state", "frame",
+};
+
+struct FscProfiler {
+    bool enabled = false;
+    uint64_t budgetNs = 0;
+    uint64_t overBudget = 0;
+    std::chrono::steady_clock::time_point since{};
+    std::array<FscLatencyHistogram, kFscStageCount> stages{};
+};
+FscProfiler g_fscProfiler;
+
+// Feeds the profiler histogram and, with fsc.trace=1, a trace span.
+class FscStageTimer {
+public:
+    explicit FscStageTimer(FscStage stage)
+        : stage_(stage), profile_(g_fscProfiler.enabled), trace_(fscTraceEnabled()) {
+        if (profile_ || trace_) {
+            start_ = std::chrono::steady_clock::now();
         }
-        g_fscLastResync = now;
-        g_fscDeferredInit.pending = false;
-        g_fscDeferredInit.attempts = 0;
-        logLine("FSC deferred init: bindings ready for profile '" + g_fscProfileId + "'");
-        updateFscLifecycle("fsc deferred init");
+    }
+    ~FscStageTimer() {
+        if (!profile_ && !trace_) {
+            return;
+        }
+        const auto end = std::chrono::steady_clock::now();
+        if (profile_) {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start_);
+            g_fscProfiler.stages[static_cast<size_t>(stage_)].record(static_cast<uint64_t>(ns.count()));
+        }
+        if (trace_) {
+            fscTraceSpan(kFscStageNames[static_cast<size_t>(stage_)], start_, end);
+        }
+    }
+    FscStageTimer(const FscStageTimer&) = delete;
+    FscStageTimer& operator=(const FscStageTimer&) = delete;
+
+private:
+    FscStage stage_;
+    bool profile_;
+    bool trace_;
+    std::chrono::steady_clock::time_point start_{};
+};
+
+static void resetFscProfiler() {
+    g_fscProfiler.enabled = g_prefs.fsc.profiler;
+    g_fscProfiler.budgetNs = static_cast<uint64_t>(g_prefs.fsc.profilerBudgetUs) * 1000u;
+    g_fscProfiler.overBudget = 0;
+    g_fscProfiler.since = std::chrono::steady_clock::now();
+    for (auto& h : g_fscProfiler.stages) {
+        h = FscLatencyHistogram{};
+    }
+    if (g_fscProfileStatus) {
+        XPSetWidgetDescriptor(g_fscProfileStatus, g_fscProfiler.enabled ? "Frame: no samples yet"
+                                                                        : "Frame: profiler off (fsc.profiler=0)");
+    }
+}
+
+static std::string formatFscStageStats(FscStage stage) {
+    const auto& h = g_fscProfiler.stages[static_cast<size_t>(stage)];
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1) << kFscStageNames[static_cast<size_t>(stage)]
+        << " p50=" << h.percentile(50.0) / 1000.0 << " p99=" << h.percentile(99.0) / 1000.0
+        << " max=" << h.maxNs / 1000.0 << " us";
+    return oss.str();
+}
+
+static void dumpFscProfiler() {
+    if (!g_fscProfiler.enabled) {
+        logLine("FSC PROF: profiler disabled (set fsc.profiler=1)");
         return;
     }
+    const auto& frame = g_fscProfiler.stages[static_cast<size_t>(FscStage::Frame)];
+    const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - g_fscProfiler.since).count();
+    std::ostringstream oss;
+    oss << "FSC PROF: " << frame.total << " frames in " << std::fixed << std::setprecision(0) << secs
+        << " s, budget=" << g_fscProfiler.budgetNs / 1000 << " us, over budget=" << g_fscProfiler.overBudget;
+    if (frame.total > 0) {
+        oss << " (" << std::setprecision(3)
+            << 100.0 * static_cast<double>(g_fscProfiler.overBudget) / static_cast<double>(frame.total) << "%)";
+    }
+    logLine(oss.str());
+    for (size_t i = 0; i < kFscStageCount; ++i) {
+        const auto& h = g_fscProfiler.stages[i];
+        if (h.total == 0) {
+            continue;
+        }
+        std::ostringstream line;
+        line << "FSC PROF: " << formatFscStageStats(static_cast<FscStage>(i)) << std::setprecision(1)
+             << " mean=" << static_cast<double>(h.sumNs) / static_cast<double>(h.total) / 1000.0
+             << " us n=" << h.total;
+        logLine(line.str());
+    }
+}
 
-    if (++g_fscDeferredInit.attempts >= kMaxAttempts) {
-        g_fscDeferredInit.pending = false;
-        logLine("FSC deferred init: bindings still missing, giving up.");
+static void recordFscFrame(uint64_t ns) {
+    g_fscProfiler.stages[static_cast<size_t>(FscStage::Frame)].record(ns);
+    if (g_fscProfiler.budgetNs > 0 && ns > g_fscProfiler.budgetNs) {
+        ++g_fscProfiler.overBudget;
+    }
+    static auto lastWindowUpdate = std::chrono::steady_clock::time_point{};
+    const auto now = std::chrono::steady_clock::now();
+    if (g_fscProfileStatus && XPIsWidgetVisible(g_fscWindow) &&
+        now - lastWindowUpdate >= std::chrono::milliseconds(500)) {
+        lastWindowUpdate = now;
+        const std::string text = "Frame: " + formatFscStageStats(FscStage::Frame) +
+                                 ", over budget " + std::to_string(g_fscProfiler.overBudget);
+        XPSetWidgetDescriptor(g_fscProfileStatus, text.c_str());
+    }
+}
+
+// Derives the per-second packet rates from the counters (sim thread).
+static void updateFscMetricRates(std::chrono::steady_clock::time_point now) {
+    static auto last = std::chrono::steady_clock::time_point{};
+    static std::array<uint64_t, kFscCommandSlots> lastCounts{};
+    static uint64_t lastTotal = 0;
+    if (last.time_since_epoch().count() != 0 && now - last < std::chrono::seconds(1)) {
         return;
     }
-    g_fscDeferredInit.due = now + kRetryDelay;
+    const float dt = last.time_since_epoch().count() == 0 ? 0.0f : std::chrono::duration<float>(now - last).count();
+    last = now;
+    for (size_t i = 0; i < kFscCommandSlots; ++i) {
+        const uint64_t count = g_fscMetrics.cmdPackets[i].get();
+        g_fscMetrics.cmdPacketsPerSec[i].set(dt > 0.0f ? static_cast<float>(count - lastCounts[i]) / dt : 0.0f);
+        lastCounts[i] = count;
+    }
+    const uint64_t total = g_fscMetrics.packets.get();
+    g_fscMetrics.packetsPerSec.set(dt > 0.0f ? static_cast<float>(total - lastTotal) / dt : 0.0f);
+    lastTotal = total;
 }
 
+static void runFscFrame();
+
 float flightLoopCallback(
     float /*inElapsedSinceLastCall*/,
     float /*inElapsedTimeSinceLastFlightLoop*/,
     int /*inCounter*/,
     void* /*inRefcon*/) {
-    maybeRunFscDeferredInit();
+    setFscTraceThreadName("sim");
+    const auto start = std::chrono::steady_clock::now();
+    runFscFrame();
+    const auto end = std::chrono::steady_clock::now();
+    if (fscTraceEnabled()) {
+        fscTraceSpan("frame", start, end);
+    }
+    if (g_fscProfiler.enabled) {
+        recordFscFrame(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+    }
+    const float us = std::chrono::duration<float, std::micro>(end - start).count();
+    g_fscMetrics.frameUs.set(us);
+    if (us > g_fscMetrics.frameMaxUs.get()) {
+        g_fscMetrics.frameMaxUs.set(us);
+    }
+    updateFscMetricRates(end);
+    return -1.0f;  // next frame
+}
+
+static void runFscFrame() {
+    {
+        FscStageTimer timer(FscStage::DeferredInit);
+        maybeRunFscDeferredInit();
+    }
 
     if (g_prefs.fsc.enabled) {
         FscState snapshot;
         {
+            FscStageTimer timer(FscStage::Snapshot);
             std::lock_guard<std::mutex> lock(g_fscMutex);
             snapshot = g_fscState;
             g_fscState.trimWheelDelta = 0;
         }
+        {
+            FscStageTimer timer(FscStage::Health);
+            updateFscChannelHealth(snapshot);
+        }
         bool calibActive = false;
         {
             std::lock_guard<std::mutex> lock(g_fscCalibMutex);
             calibActive = g_fscCalib.active;
         }
         if (calibActive) {
+            FscStageTimer timer(FscStage::Calibration);
             updateFscCalibration(snapshot);
         } else if (g_fscProfileActive.load()) {
-            auto now = std::chrono::steady_clock::now();
-            if (g_fscResyncPending.load()) {
-                if (snapshot.digital >= 0 || snapshot.stabTrim >= 0) {
-                    resyncFscLatchingInputs(snapshot);
-                    g_fscLastResync = now;
-                    g_fscResyncPending.store(false);
-                }
-            } else if (g_fscProfileRuntime.sync.resyncIntervalSec > 0.0f) {
-                auto interval = std::chrono::duration<float>(g_fscProfileRuntime.sync.resyncIntervalSec);
-                if (g_fscLastResync.time_since_epoch().count() == 0 ||
-                    now - g_fscLastResync >= interval) {
+            {
+                FscStageTimer timer(FscStage::Resync);
+                auto now = std::chrono::steady_clock::now();
+                if (g_fscResyncPending.load()) {
                     if (snapshot.digital >= 0 || snapshot.stabTrim >= 0) {
                         resyncFscLatchingInputs(snapshot);
                         g_fscLastResync = now;
+                        g_fscResyncPending.store(false);
+                    }
+                } else if (g_fscProfileRuntime.sync.resyncIntervalSec > 0.0f) {
+                    auto interval = std::chrono::duration<float>(g_fscProfileRuntime.sync.resyncIntervalSec);
+                    if (g_fscLastResync.time_since_epoch().count() == 0 ||
+                        now - g_fscLastResync >= interval) {
+                        if (snapshot.digital >= 0 || snapshot.stabTrim >= 0) {
+                            resyncFscLatchingInputs(snapshot);
+                            g_fscLastResync = now;
+                        }
+                    }
+                }
+                bool didAxisResync = false;
+                if (g_fscAxisResyncPending.load() && now >= g_fscAxisResyncDue) {
+                    resyncFscDetentAxes();
+                    g_fscAxisResyncPending.store(false);
+                    didAxisResync = true;
+                }
+                if (g_fscAxisResyncSecondPending.load() && now >= g_fscAxisResyncSecondDue) {
+                    if (!didAxisResync) {
+                        resyncFscDetentAxes();
                     }
+                    g_fscAxisResyncSecondPending.store(false);
                 }
             }
-            bool didAxisResync = false;
-            if (g_fscAxisResyncPending.load() && now >= g_fscAxisResyncDue) {
-                resyncFscDetentAxes();
-                g_fscAxisResyncPending.store(false);
-                didAxisResync = true;
+            {
+                FscStageTimer timer(FscStage::Outputs);
+                processFscOutputs(snapshot);
             }
-            if (g_fscAxisResyncSecondPending.load() && now >= g_fscAxisResyncSecondDue) {
-                if (!didAxisResync) {
-                    resyncFscDetentAxes();
+            if (snapshot.complete) {
+                {
+                    FscStageTimer timer(FscStage::StalePolicy);
+                    applyFscStalePolicy(snapshot);
                 }
-                g_fscAxisResyncSecondPending.store(false);
+                FscStageTimer timer(FscStage::State);
+                processFscState(snapshot);
             }
-            processFscOutputs(snapshot);
-            processFscState(snapshot);
         }
     }
-
-    return -1.0f;  // next frame
 }
 
 float clamp01(float v) {
@@ -4444,6 +6557,7 @@ static bool fscWriteBytes(intptr_t handle, const uint8_t* data, size_t len) {
         errno = EBADF;
         return false;
     }
+    FscTraceScope trace("write", len > 0 ? data[0] : -1);
 #if IBM
     HANDLE h = reinterpret_cast<HANDLE>(handle);
     DWORD written = 0;
@@ -4464,6 +6578,7 @@ static bool fscWriteBytes(intptr_t handle, const uint8_t* data, size_t len) {
 
 void fscSendPoll() {
     const uint8_t frame[3] = {0x93, 0x00, 0x10};
+    fscTraceInstant("poll");
     std::lock_guard<std::mutex> lock(g_fscIoMutex);
     intptr_t handle = g_fscFd.load();
     if (handle < 0) {
@@ -4482,12 +6597,12 @@ void fscSendPoll() {
     }
 }
 
-void fscWriteFrame(uint8_t a, uint8_t b, uint8_t c) {
+bool fscWriteFrame(uint8_t a, uint8_t b, uint8_t c) {
     const uint8_t frame[3] = {a, b, c};
     std::lock_guard<std::mutex> lock(g_fscIoMutex);
     intptr_t handle = g_fscFd.load();
     if (handle < 0) {
-        return;
+        return false;
     }
     if (!fscWriteBytes(handle, frame, sizeof(frame))) {
 #if IBM
@@ -4499,7 +6614,9 @@ void fscWriteFrame(uint8_t a, uint8_t b, uint8_t c) {
 #endif
         closeFscPort(handle);
         g_fscFd.store(-1);
+        return false;
     }
+    return true;
 }
 
 void fscWritePosition(uint8_t base, int value0to255) {
@@ -4512,89 +6629,35 @@ void fscWritePosition(uint8_t base, int value0to255) {
 
 void handleFscPacket(uint8_t cmdByte, uint8_t dataByte) {
     uint8_t cmd = static_cast<uint8_t>(cmdByte & 0x7E);  // strip MSB, keep command bits (1..6)
-    uint8_t msb = static_cast<uint8_t>(cmdByte & 0x01);
     uint8_t y = static_cast<uint8_t>(dataByte & 0x7F);
-    uint8_t value = static_cast<uint8_t>((msb << 7) | y);
+    const int value = fsc_proto::packetValue(cmdByte, dataByte);
 
     static int lastTrimAB = -1;
 
+    const FscCommandDesc& desc = fscCommandDesc(cmd);
+    if (!(desc.types & fscTypeBit(g_prefs.fsc.type))) {
+        return;  // unknown, or used by another hardware variant (counted in fscLoop)
+    }
+    const auto now = std::chrono::steady_clock::now();
     std::lock_guard<std::mutex> lock(g_fscMutex);
-    switch (cmd) {
-        case 0x12:  // digital inputs (active low)
-            g_fscState.digital = value;
-            break;
-        case 0x16:  // stab trim switches (bitfield in y)
-            g_fscState.stabTrim = value;
-            break;
-        case 0x20:  // reverser 1
-            g_fscState.reverser1 = value;
-            break;
-        case 0x22:  // reverser 2
-            g_fscState.reverser2 = value;
+    switch (desc.kind) {
+        case FscPacketKind::Channel:
+            *fscChannelValue(g_fscState, desc.channel) = value;
+            markFscChannelLocked(desc.channel, now);
             break;
-        case 0x24:  // throttle 1
-            g_fscState.throttle1 = value;
-            break;
-        case 0x26:  // throttle 2
-            g_fscState.throttle2 = value;
-            break;
-        case 0x2A:  // flaps (semi-pro)
-            if (g_prefs.fsc.type == Prefs::FscType::SemiPro) {
-                g_fscState.flaps = value;
+        case FscPacketKind::FlapsTrim: {  // flaps + trim wheel (pro/motorized)
+            const int flapSetting = fsc_proto::decodeFlapCode(y);
+            if (flapSetting >= 0) {
+                g_fscState.flaps = flapSetting;
+                markFscChannelLocked(FscChannel::Flaps, now);
             }
-            break;
-        case 0x10: {  // flaps + trim wheel (pro/motorized)
-            if (g_prefs.fsc.type == Prefs::FscType::Pro || g_prefs.fsc.type == Prefs::FscType::Motorized) {
-                uint8_t flapCode = static_cast<uint8_t>(y & 0x0F);
-                int flapSetting = -1;
-                switch (flapCode) {
-                    case 0x8: flapSetting = 0; break;   // 1000
-                    case 0xC: flapSetting = 1; break;   // 1100
-                    case 0xE: flapSetting = 2; break;   // 1110
-                    case 0xF: flapSetting = 5; break;   // 1111
-                    case 0x7: flapSetting = 10; break;  // 0111
-                    case 0x3: flapSetting = 15; break;  // 0011
-                    case 0x2: flapSetting = 25; break;  // 0010
-                    case 0x1: flapSetting = 30; break;  // 0001
-                    case 0x9: flapSetting = 40; break;  // 1001
-                    default: break;
-                }
-                if (flapSetting >= 0) {
-                    g_fscState.flaps = flapSetting;
-                }
-
-                int a = (y >> 4) & 0x01;
-                int b = (y >> 5) & 0x01;
-                int ab = (a << 1) | b;
-                if (lastTrimAB >= 0 && ab != lastTrimAB) {
-                    // Gray code quadrature decode
-                    int delta = 0;
-                    switch ((lastTrimAB << 2) | ab) {
-                        case 0b0001:
-                        case 0b0111:
-                        case 0b1110:
-                        case 0b1000:
-                            delta = +1;
-                            break;
-                        case 0b0010:
-                        case 0b1011:
-                        case 0b1101:
-                        case 0b0100:
-                            delta = -1;
-                            break;
-                        default:
-                            delta = 0;
-                            break;
-                    }
-                    g_fscState.trimWheelDelta += delta;
-                }
-                lastTrimAB = ab;
+            const int ab = fsc_proto::trimWheelBits(y);
+            if (lastTrimAB >= 0 && ab != lastTrimAB) {
+                g_fscState.trimWheelDelta += fsc_proto::trimWheelStep(lastTrimAB, ab);
             }
+            lastTrimAB = ab;
             break;
         }
-        case 0x2C:  // speedbrake
-            g_fscState.speedbrake = value;
-            break;
         default:
             break;
     }
@@ -4779,6 +6842,11 @@ static void scheduleFscAxisResync() {
         std::lock_guard<std::mutex> lock(g_fscMutex);
         g_fscState.flaps = -1;
         g_fscState.speedbrake = -1;
+        for (FscChannel ch : {FscChannel::Flaps, FscChannel::Speedbrake}) {
+            g_fscState.sampleValue[static_cast<size_t>(ch)] = -1.0f;
+            g_fscState.prevValue[static_cast<size_t>(ch)] = -1.0f;
+            g_fscState.filterValue[static_cast<size_t>(ch)] = -1.0f;
+        }
     }
     float delay = g_fscProfileRuntime.sync.startupDelaySec;
     if (delay < 0.0f) {
@@ -4825,6 +6893,214 @@ static bool resyncFscDetentAxes() {
     return didResync;
 }
 
+static std::string fscChannelHealthSummary(const FscState& state, std::chrono::steady_clock::time_point now) {
+    uint32_t shown = g_fscRequiredChannels.load();
+    if (shown == 0) {
+        shown = state.seen;
+    }
+    std::ostringstream oss;
+    oss << "Inputs:";
+    bool any = false;
+    for (size_t i = 0; i < kFscChannelCount; ++i) {
+        if (!(shown & fscChannelBit(static_cast<FscChannel>(i)))) {
+            continue;
+        }
+        oss << (any ? " | " : " ") << kFscChannelShortNames[i] << ' ';
+        any = true;
+        switch (g_fscChannelHealth[i]) {
+            case FscChannelHealth::Unknown:
+                oss << "--";
+                break;
+            case FscChannelHealth::Stale:
+                oss << "STALE " << std::fixed << std::setprecision(1)
+                    << std::chrono::duration<float>(now - state.updatedAt[i]).count() << "s";
+                break;
+            case FscChannelHealth::Ok:
+                if (state.intervalMs[i] > 0.0f) {
+                    oss << std::fixed << std::setprecision(0) << (1000.0f / state.intervalMs[i]) << "Hz";
+                } else {
+                    oss << "OK";
+                }
+                break;
+        }
+    }
+    if (!any) {
+        oss << " no data";
+    }
+    return oss.str();
+}
+
+// Classifies each channel by the age of its last update, logs transitions for
+// channels the profile uses and refreshes the setup window summary.
+static void updateFscChannelHealth(const FscState& state) {
+    const auto now = std::chrono::steady_clock::now();
+    const uint32_t required = g_fscRequiredChannels.load();
+    const auto staleAfter = std::chrono::milliseconds(g_prefs.fsc.staleMs);
+    uint32_t staleMask = 0;
+    for (size_t i = 0; i < kFscChannelCount; ++i) {
+        const uint32_t bit = fscChannelBit(static_cast<FscChannel>(i));
+        FscChannelHealth health = FscChannelHealth::Ok;
+        if (!(state.seen & bit)) {
+            health = FscChannelHealth::Unknown;
+        } else if (g_prefs.fsc.staleMs > 0 && now - state.updatedAt[i] > staleAfter) {
+            health = FscChannelHealth::Stale;
+        }
+        const FscChannelHealth prev = g_fscChannelHealth[i];
+        g_fscChannelHealth[i] = health;
+        if (health == FscChannelHealth::Stale) {
+            staleMask |= bit;
+        }
+        if (health == prev || !(required & bit)) {
+            continue;
+        }
+        if (health == FscChannelHealth::Stale) {
+            const long long ageMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - state.updatedAt[i]).count();
+            logLine(std::string("FSC: channel ") + kFscChannelNames[i] + " stale (no update for " +
+                    std::to_string(ageMs) + " ms, avg interval " +
+                    std::to_string(static_cast<int>(state.intervalMs[i])) + " ms), action=" +
+                    fscStaleActionToString(g_prefs.fsc.staleAction));
+            triggerFscRecorder(kFscRecStale, kFscChannelNames[i]);
+        } else if (health == FscChannelHealth::Ok && prev == FscChannelHealth::Stale) {
+            logLine(std::string("FSC: channel ") + kFscChannelNames[i] + " recovered");
+        }
+    }
+
+    g_fscMetrics.staleMask.set(staleMask);
+
+    static auto lastWindowUpdate = std::chrono::steady_clock::time_point{};
+    if (g_fscHealthStatus && XPIsWidgetVisible(g_fscWindow) &&
+        now - lastWindowUpdate >= std::chrono::milliseconds(500)) {
+        lastWindowUpdate = now;
+        XPSetWidgetDescriptor(g_fscHealthStatus, fscChannelHealthSummary(state, now).c_str());
+    }
+}
+
+// Stale channels are frozen (reported as unknown, so no sim writes) or, for
+// throttles/reversers with fsc.stale_action=failsafe, driven to idle/stowed.
+// Their filter chain output and sample history are dropped from the snapshot,
+// so neither the last filtered value nor the predictor overrides the policy.
+static void applyFscStalePolicy(FscState& state) {
+    for (size_t i = 0; i < kFscChannelCount; ++i) {
+        if (g_fscChannelHealth[i] != FscChannelHealth::Stale) {
+            continue;
+        }
+        const auto ch = static_cast<FscChannel>(i);
+        int* value = fscChannelValue(state, ch);
+        if (!value) {
+            continue;
+        }
+        *value = -1;
+        state.sampleValue[i] = -1.0f;
+        state.prevValue[i] = -1.0f;
+        state.filterValue[i] = -1.0f;
+        if (g_prefs.fsc.staleAction != Prefs::FscStaleAction::Failsafe) {
+            continue;
+        }
+        FscAxisId axis = FscAxisId::Count;
+        switch (ch) {
+            case FscChannel::Throttle1: axis = FscAxisId::Throttle1; break;
+            case FscChannel::Throttle2: axis = FscAxisId::Throttle2; break;
+            case FscChannel::Reverser1: axis = FscAxisId::Reverser1; break;
+            case FscChannel::Reverser2: axis = FscAxisId::Reverser2; break;
+            default: break;
+        }
+        if (axis == FscAxisId::Count) {
+            continue;
+        }
+        const auto& mapping = g_fscProfileRuntime.axes[static_cast<size_t>(axis)];
+        int minv = 0;
+        int maxv = 0;
+        if (!mapping.defined || !getPrefIntByKey(mapping.sourceRefMin, minv) ||
+            !getPrefIntByKey(mapping.sourceRefMax, maxv)) {
+            continue;
+        }
+        bool invert = mapping.invert;
+        if (!mapping.invertRef.empty()) {
+            bool inv = false;
+            if (getPrefBoolByKey(mapping.invertRef, inv)) {
+                invert = inv;
+            }
+        }
+        *value = invert ? maxv : minv;
+    }
+}
+
+// Sim thread: called when a profile is activated or cleared. Hands the axis
+// filter chains to the I/O thread, which runs them from the next sample on.
+static void configureFscFilters() {
+    std::lock_guard<std::mutex> lock(g_fscMutex);
+    for (size_t i = 0; i < static_cast<size_t>(FscAxisId::Count); ++i) {
+        const auto axis = static_cast<FscAxisId>(i);
+        FscChannel ch = FscChannel::Count;
+        switch (axis) {
+            case FscAxisId::Throttle1: ch = FscChannel::Throttle1; break;
+            case FscAxisId::Throttle2: ch = FscChannel::Throttle2; break;
+            case FscAxisId::Reverser1: ch = FscChannel::Reverser1; break;
+            case FscAxisId::Reverser2: ch = FscChannel::Reverser2; break;
+            case FscAxisId::Speedbrake: ch = FscChannel::Speedbrake; break;
+            case FscAxisId::Flaps: ch = FscChannel::Flaps; break;
+            default: continue;
+        }
+        const auto& mapping = g_fscProfileRuntime.axes[i];
+        const size_t c = static_cast<size_t>(ch);
+        g_fscAxisFilters[c].configure(mapping.defined ? mapping.filters : fsc_filter::ChainConfig{});
+        g_fscState.sampleValue[c] = -1.0f;
+        g_fscState.prevValue[c] = -1.0f;
+        g_fscState.filterValue[c] = -1.0f;
+    }
+}
+
+// Extrapolates a lever to |now| from its last two samples: the newest sample is
+// (now - received + latency) old. The velocity is bounded by max_rate, the lead
+// by max_lead_ms, and the result never passes an endpoint or a detent the
+// lever has not reached yet. A lever without a sample for twice its last
+// sample interval is taken as stopped.
+static float predictFscAxisRaw(const FscState& state, FscChannel ch, float raw, const FscAxisMapping& mapping,
+                               std::chrono::steady_clock::time_point now) {
+    const auto& cfg = mapping.predict;
+    const size_t i = static_cast<size_t>(ch);
+    if (!cfg.enabled || raw < 0 || state.prevValue[i] < 0 || state.sampleValue[i] < 0 ||
+        state.prevAt[i].time_since_epoch().count() == 0) {
+        return raw;
+    }
+    const float sampleDt = std::chrono::duration<float>(state.updatedAt[i] - state.prevAt[i]).count();
+    const float sinceLast = std::chrono::duration<float>(now - state.updatedAt[i]).count();
+    if (sampleDt < 0.001f || sinceLast > 2.0f * sampleDt + 0.005f) {
+        return raw;
+    }
+    const float rate = std::clamp((state.sampleValue[i] - state.prevValue[i]) / sampleDt, -cfg.maxRate, cfg.maxRate);
+    const float lead = std::min(sinceLast + cfg.latencyMs / 1000.0f, cfg.maxLeadMs / 1000.0f);
+    float predicted = raw + rate * lead;
+
+    int minv = 0;
+    int maxv = 0;
+    if (getPrefIntByKey(mapping.sourceRefMin, minv) && getPrefIntByKey(mapping.sourceRefMax, maxv)) {
+        predicted = std::clamp(predicted, static_cast<float>(std::min(minv, maxv)), static_cast<float>(std::max(minv, maxv)));
+    }
+    for (const auto& ref : cfg.detentRefs) {
+        int detent = 0;
+        if (!getPrefIntByKey(ref, detent)) {
+            continue;
+        }
+        if ((raw < detent && predicted > detent) || (raw > detent && predicted < detent)) {
+            predicted = static_cast<float>(detent);
+        }
+    }
+    return predicted;
+}
+
+// Axis input: the output of the profile's filter chain for the channel (as of
+// the last output tick), or the raw value when the axis declares none. Unknown
+// (resync) stays -1; stale channels get the raw value applyFscStalePolicy()
+// put into the snapshot.
+static float fscAxisInput(const FscState& state, FscChannel ch, int raw, const FscAxisMapping& mapping) {
+    const float filtered = state.filterValue[static_cast<size_t>(ch)];
+    if (raw < 0 || mapping.filters.count == 0 || filtered < 0.0f) {
+        return static_cast<float>(raw);
+    }
+    return filtered;
+}
+
 void processFscState(const FscState& state) {
     if (!g_fscProfileActive.load()) {
         return;
@@ -4894,8 +7170,8 @@ void processFscState(const FscState& state) {
         }
     }
 
-    auto mapAxis = [&](int raw, const FscAxisMapping& mapping) -> std::optional<float> {
-        if (raw < 0) return std::nullopt;
+    auto mapAxis = [&](float raw, const FscAxisMapping& mapping) -> std::optional<float> {
+        if (raw < 0.0f) return std::nullopt;
         int minv = 0;
         int maxv = 0;
         if (!getPrefIntByKey(mapping.sourceRefMin, minv) || !getPrefIntByKey(mapping.sourceRefMax, maxv)) {
@@ -4904,7 +7180,7 @@ void processFscState(const FscState& state) {
         if (maxv == minv) {
             return std::nullopt;
         }
-        float f = static_cast<float>(raw - minv) / static_cast<float>(maxv - minv);
+        float f = (raw - static_cast<float>(minv)) / static_cast<float>(maxv - minv);
         f = clamp01(f);
         bool invert = mapping.invert;
         if (!mapping.invertRef.empty()) {
@@ -4918,6 +7194,12 @@ void processFscState(const FscState& state) {
         }
         return mapping.targetMin + (mapping.targetMax - mapping.targetMin) * f;
     };
+    // Filtered (or raw) input, extrapolated to now, mapped to the target range.
+    auto readAxis = [&](FscChannel ch, int raw, const FscAxisMapping& mapping) -> std::optional<float> {
+        return mapAxis(predictFscAxisRaw(state, ch, fscAxisInput(state, ch, raw, mapping), mapping,
+                                         std::chrono::steady_clock::now()),
+                       mapping);
+    };
 
     struct ThrottleFilterState {
         int lastRaw1 = -1;
@@ -4969,15 +7251,27 @@ void processFscState(const FscState& state) {
             return raw;
         };
 
-        int rawT1 = mapT1.defined ? applyDeadband(state.throttle1, throttleFilter.lastRaw1) : -1;
-        int rawT2 = mapT2.defined ? applyDeadband(state.throttle2, throttleFilter.lastRaw2) : -1;
-
-        auto t1 = mapT1.defined ? mapAxis(rawT1, mapT1) : std::nullopt;
-        auto t2 = mapT2.defined ? mapAxis(rawT2, mapT2) : std::nullopt;
+        // A profile filter chain replaces the deadband and smoothing prefs for
+        // its lever. Otherwise extrapolate only a lever that got past the
+        // deadband this frame.
+        const auto now = std::chrono::steady_clock::now();
+        auto throttleInput = [&](FscChannel ch, int raw, int& lastRaw, const FscAxisMapping& mapping) -> float {
+            if (mapping.filters.count > 0) {
+                return predictFscAxisRaw(state, ch, fscAxisInput(state, ch, raw, mapping), mapping, now);
+            }
+            const int held = applyDeadband(raw, lastRaw);
+            return held == raw ? predictFscAxisRaw(state, ch, static_cast<float>(held), mapping, now)
+                               : static_cast<float>(held);
+        };
+        auto t1 = mapT1.defined
+                      ? mapAxis(throttleInput(FscChannel::Throttle1, state.throttle1, throttleFilter.lastRaw1, mapT1), mapT1)
+                      : std::nullopt;
+        auto t2 = mapT2.defined
+                      ? mapAxis(throttleInput(FscChannel::Throttle2, state.throttle2, throttleFilter.lastRaw2, mapT2), mapT2)
+                      : std::nullopt;
 
         float alpha = 1.0f;
         if (g_prefs.fsc.throttleSmoothMs > 0) {
-            auto now = std::chrono::steady_clock::now();
             float dt = 0.0f;
             if (throttleFilter.lastTime.time_since_epoch().count() != 0) {
                 dt = std::chrono::duration<float>(now - throttleFilter.lastTime).count();
@@ -5007,8 +7301,12 @@ void processFscState(const FscState& state) {
             return filtered;
         };
 
-        t1 = smoothValue(t1, throttleFilter.filtered1, throttleFilter.init1);
-        t2 = smoothValue(t2, throttleFilter.filtered2, throttleFilter.init2);
+        if (mapT1.filters.count == 0) {
+            t1 = smoothValue(t1, throttleFilter.filtered1, throttleFilter.init1);
+        }
+        if (mapT2.filters.count == 0) {
+            t2 = smoothValue(t2, throttleFilter.filtered2, throttleFilter.init2);
+        }
 
         if (t1.has_value() && t2.has_value() && g_prefs.fsc.throttleSyncBand > 0.0f) {
             float diff = std::fabs(*t1 - *t2);
@@ -5036,7 +7334,7 @@ void processFscState(const FscState& state) {
 
     const auto& mapR1 = g_fscProfileRuntime.axes[static_cast<size_t>(FscAxisId::Reverser1)];
     if (mapR1.defined) {
-        if (auto r1 = mapAxis(state.reverser1, mapR1)) {
+        if (auto r1 = readAxis(FscChannel::Reverser1, state.reverser1, mapR1)) {
             for (const auto& target : mapR1.targets) {
                 setDatarefValue(target.dataref, target.datarefType, *r1, target.index);
             }
@@ -5056,7 +7354,7 @@ void processFscState(const FscState& state) {
 
     const auto& mapR2 = g_fscProfileRuntime.axes[static_cast<size_t>(FscAxisId::Reverser2)];
     if (mapR2.defined) {
-        if (auto r2 = mapAxis(state.reverser2, mapR2)) {
+        if (auto r2 = readAxis(FscChannel::Reverser2, state.reverser2, mapR2)) {
             for (const auto& target : mapR2.targets) {
                 setDatarefValue(target.dataref, target.datarefType, *r2, target.index);
             }
@@ -5077,7 +7375,7 @@ void processFscState(const FscState& state) {
     if (!g_fscProfileRuntime.speedbrake.enabled) {
         const auto& mapSb = g_fscProfileRuntime.axes[static_cast<size_t>(FscAxisId::Speedbrake)];
         if (mapSb.defined) {
-            if (auto sb = mapAxis(state.speedbrake, mapSb)) {
+            if (auto sb = readAxis(FscChannel::Speedbrake, state.speedbrake, mapSb)) {
                 for (const auto& target : mapSb.targets) {
                     setDatarefValue(target.dataref, target.datarefType, *sb, target.index);
                 }
@@ -5088,7 +7386,7 @@ void processFscState(const FscState& state) {
     if (!g_fscProfileRuntime.flaps.enabled) {
         const auto& mapFlaps = g_fscProfileRuntime.axes[static_cast<size_t>(FscAxisId::Flaps)];
         if (mapFlaps.defined) {
-            if (auto fl = mapAxis(state.flaps, mapFlaps)) {
+            if (auto fl = readAxis(FscChannel::Flaps, state.flaps, mapFlaps)) {
                 for (const auto& target : mapFlaps.targets) {
                     setDatarefValue(target.dataref, target.datarefType, *fl, target.index);
                 }
@@ -5098,7 +7396,9 @@ void processFscState(const FscState& state) {
 
     bool speedbrakeMotorActive = motorizedHw && g_fscProfileRuntime.motorized.enabled && g_fscMotorSpeedbrakeActive.load();
     if (g_fscProfileRuntime.speedbrake.enabled && !speedbrakeMotorActive && state.speedbrake >= 0) {
-        int speedbrake = state.speedbrake;
+        // Detents see the axis filter chain output too (the axis mapping itself is unused here).
+        const auto& mapSb = g_fscProfileRuntime.axes[static_cast<size_t>(FscAxisId::Speedbrake)];
+        int speedbrake = static_cast<int>(std::lround(fscAxisInput(state, FscChannel::Speedbrake, state.speedbrake, mapSb)));
         if (!g_fscProfileRuntime.speedbrake.invertRef.empty()) {
             bool inv = false;
             if (getPrefBoolByKey(g_fscProfileRuntime.speedbrake.invertRef, inv) && inv) {
@@ -5185,6 +7485,8 @@ void processFscState(const FscState& state) {
     }
 
     if (g_fscProfileRuntime.flaps.enabled && state.flaps >= 0) {
+        const auto& mapFlaps = g_fscProfileRuntime.axes[static_cast<size_t>(FscAxisId::Flaps)];
+        const int flaps = static_cast<int>(std::lround(fscAxisInput(state, FscChannel::Flaps, state.flaps, mapFlaps)));
         int bestIdx = -1;
         int bestDiff = 9999;
         int bestValue = -1;
@@ -5194,7 +7496,7 @@ void processFscState(const FscState& state) {
             if (!getPrefIntByKey(pos.sourceRef, ref)) {
                 continue;
             }
-            int diff = std::abs(state.flaps - ref);
+            int diff = std::abs(flaps - ref);
             if (g_fscProfileRuntime.flaps.modeNearest) {
                 if (diff < bestDiff) {
                     bestDiff = diff;
@@ -5535,7 +7837,10 @@ void updateFscCalibration(const FscState& inputState) {
         return;
     }
     if (!g_fscCalib.safeOutputsSent && g_fscCalib.type == Prefs::FscType::Motorized && fscIsConnected()) {
-        fscWriteFrame(0x93, 0x00, 0x00);  // motors off
+        {
+            std::lock_guard<std::mutex> lock(g_fscOutputMutex);
+            g_fscOutputIntent.motorPower = 0;  // motors off
+        }
         g_fscMotorThrottleActive.store(false);
         g_fscMotorSpeedbrakeActive.store(false);
         g_fscCalib.safeOutputsSent = true;
@@ -5552,46 +7857,248 @@ bool fscIsConnected() {
     return g_fscFd.load() >= 0;
 }
 
-void processFscOutputs(const FscState& inputState) {
-    if (!fscIsConnected() || !g_fscProfileActive.load()) {
+// Motorized targets (0x8B second byte = base | value MSB).
+enum class FscMotor { Throttle1, Throttle2, Speedbrake, TrimIndicator, Count };
+constexpr size_t kFscMotorCount = static_cast<size_t>(FscMotor::Count);
+constexpr uint8_t kFscMotorBase[kFscMotorCount] = {0x00, 0x10, 0x20, 0x30};
+
+// Motor targets: the sim thread sets final targets, the I/O thread plans
+// rate/accel/jerk-limited trajectories and writes the intermediate positions
+// every periodMs (FscMotionPlanner). Without motion profiles the limits are 0
+// and a target is written as is.
+struct FscMotionShared {
+    bool enabled = false;
+    int periodMs = 25;
+    std::array<FscMotorLimits, kFscMotorCount> limits{};
+    std::array<int, kFscMotorCount> minIntervalMs{};            // per-motor write rate limit
+    std::array<int, kFscMotorCount> target{-1, -1, -1, -1};     // -1 = idle (stop emitting)
+    std::array<int, kFscMotorCount> startFrom{-1, -1, -1, -1};  // consumed by the I/O thread
+    std::array<uint32_t, kFscMotorCount> drive{};  // bumped when a new drive starts (from idle or startFrom)
+    uint32_t version = 0;
+};
+std::mutex g_fscMotionMutex;
+FscMotionShared g_fscMotion;
+std::atomic<bool> g_fscMotionEnabled{false};
+std::atomic<int> g_fscMotionPeriodMs{25};
+
+// Sim thread: called when a profile is activated or cleared.
+static void configureFscMotion() {
+    const auto& motor = g_fscProfileRuntime.motorized;
+    const bool enabled = g_prefs.fsc.type == Prefs::FscType::Motorized && motor.enabled;
+    const bool profiled = motor.motion.enabled;
+    std::lock_guard<std::mutex> lock(g_fscMotionMutex);
+    g_fscMotion.enabled = enabled;
+    g_fscMotion.periodMs = profiled ? motor.motion.periodMs : 0;
+    if (profiled) {
+        g_fscMotion.limits = {motor.motion.throttle, motor.motion.throttle, motor.motion.speedbrake,
+                              motor.motion.trimIndicator};
+    } else {
+        g_fscMotion.limits.fill(FscMotorLimits{0.0f, 0.0f, 0.0f});
+    }
+    g_fscMotion.minIntervalMs.fill(0);
+    g_fscMotion.target.fill(-1);
+    g_fscMotion.startFrom.fill(-1);
+    ++g_fscMotion.version;
+    g_fscMotionPeriodMs.store(g_fscMotion.periodMs);
+    g_fscMotionEnabled.store(enabled);
+}
+
+// Sim thread: new final target for a motor (-1 stops its trajectory). With a
+// |startFrom| position the trajectory restarts there (e.g. the measured lever
+// after the motor was unpowered); otherwise it continues from its current
+// position and velocity. A target after -1, a |startFrom| or |newDrive| (one-off
+// moves such as a speedbrake deploy) starts a new drive: its motor is not
+// powered on before the planner has written a position of it.
+static void setFscMotorTarget(FscMotor motor, int target, int startFrom = -1, bool newDrive = false) {
+    if (!g_fscMotionEnabled.load()) {
         return;
     }
-
-    bool parkLightAvailable = false;
-    bool parkLightOn = false;
-    {
-        const auto& mapping = g_fscProfileRuntime.indicators[static_cast<size_t>(FscIndicatorId::ParkingBrakeLight)];
-        if (mapping.defined && mapping.dataref) {
-            float value = 0.0f;
-            if (readDatarefValue(mapping.dataref, mapping.datarefType, value)) {
-                parkLightOn = value >= mapping.onMin;
-                if (mapping.invert) {
-                    parkLightOn = !parkLightOn;
-                }
-                parkLightAvailable = true;
-            }
-        }
+    std::lock_guard<std::mutex> lock(g_fscMotionMutex);
+    const size_t i = static_cast<size_t>(motor);
+    if (target >= 0 && (g_fscMotion.target[i] < 0 || startFrom >= 0 || newDrive)) {
+        ++g_fscMotion.drive[i];
     }
-    bool parkLightChanged = parkLightAvailable &&
-        (!g_fscOut.parkBrakeLightKnown || parkLightOn != g_fscOut.parkBrakeLightOn);
+    g_fscMotion.target[i] = target;
+    if (startFrom >= 0) {
+        g_fscMotion.startFrom[i] = startFrom;
+    }
+}
 
-    bool motorizedHw = (g_prefs.fsc.type == Prefs::FscType::Motorized);
-    if (!motorizedHw || !g_fscProfileRuntime.motorized.enabled) {
-        if (parkLightChanged) {
-            if (parkLightOn) {
-                fscWriteFrame(0x87, 0x11, 0x00);
-            } else {
-                fscWriteFrame(0x87, 0x10, 0x00);
+// Sim thread: minimum time between two target writes of a motor (0 = every tick).
+static void setFscMotorMinInterval(FscMotor motor, int ms) {
+    std::lock_guard<std::mutex> lock(g_fscMotionMutex);
+    g_fscMotion.minIntervalMs[static_cast<size_t>(motor)] = std::max(0, ms);
+}
+
+// Lever ratio of a raw lever position (calibration units), as the axis mapping
+// in processFscState() computes it.
+static bool fscAxisRatioForRaw(const FscAxisMapping& mapping, int raw, float& ratio) {
+    int minv = 0;
+    int maxv = 0;
+    if (!mapping.defined || raw < 0 || !getPrefIntByKey(mapping.sourceRefMin, minv) ||
+        !getPrefIntByKey(mapping.sourceRefMax, maxv) || maxv == minv) {
+        return false;
+    }
+    float f = clamp01(static_cast<float>(raw - minv) / static_cast<float>(maxv - minv));
+    bool invert = mapping.invert;
+    if (!mapping.invertRef.empty()) {
+        getPrefBoolByKey(mapping.invertRef, invert);
+    }
+    if (invert) {
+        f = 1.0f - f;
+    }
+    ratio = mapping.targetMin + (mapping.targetMax - mapping.targetMin) * f;
+    return true;
+}
+
+// Motor units (fsc.motor.throttleN_*, motorMin..motorMax for lever ratio
+// 0..1) of a reported throttle lever position (calibration units): the lever
+// ratio of the axis mapping, spread over the motor range. The servo and the
+// start of a new drive both read the lever through this.
+static bool fscThrottleMotorForLever(const FscAxisMapping& mapping, int motorMin, int motorMax, int raw, float& motor) {
+    float ratio = 0.0f;
+    if (!fscAxisRatioForRaw(mapping, raw, ratio)) {
+        return false;
+    }
+    motor = static_cast<float>(motorMin) + static_cast<float>(motorMax - motorMin) * clamp01(ratio);
+    return true;
+}
+
+// One servo step: compares the commanded motor target with the reported lever
+// position, both in motor units. Returns whether the lever's motor should be
+// powered; |send| asks for the target to be rewritten (a new drive starts).
+static bool stepFscThrottleServo(FscThrottleServo& s, const char* name, int measured, int motorTarget,
+                                 const FscMotorizedThrottleFollow& cfg, std::chrono::steady_clock::time_point now,
+                                 bool& send) {
+    using Mode = FscThrottleServo::Mode;
+    const int error = motorTarget - measured;
+    const int errorSign = (error > 0) - (error < 0);
+    if (s.lastMeasured >= 0 && s.mode != Mode::Idle) {
+        const int moved = measured - s.lastMeasured;
+        if (errorSign == 0 || errorSign != s.lastErrorSign) {
+            s.awayCounts = 0;
+        } else if (moved != 0 && (moved > 0) != (errorSign > 0)) {
+            s.awayCounts += std::abs(moved);
+        } else if (moved != 0) {
+            s.awayCounts = 0;
+        }
+    }
+    s.lastMeasured = measured;
+    s.lastErrorSign = errorSign;
+
+    if (s.mode == Mode::Stalled || s.mode == Mode::Overridden) {
+        const bool targetMoved = std::abs(motorTarget - s.blockedTarget) >= cfg.servoOverrideCounts;
+        if (now < s.blockedUntil && !targetMoved) {
+            return false;
+        }
+        s.mode = Mode::Idle;
+        s.awayCounts = 0;
+    }
+    if (s.awayCounts > cfg.servoOverrideCounts) {
+        s.mode = Mode::Overridden;
+        s.blockedTarget = motorTarget;
+        s.blockedUntil = now + std::chrono::milliseconds(cfg.servoRetryMs);
+        s.awayCounts = 0;
+        g_fscMetrics.servoOverrides.add();
+        logLine(std::string("FSC: ") + name + " servo: pilot override (lever=" + std::to_string(measured) +
+                ", target=" + std::to_string(motorTarget) + "), motor off");
+        return false;
+    }
+    // A driven lever settles inside the tolerance; a holding one is driven
+    // again only beyond twice the tolerance, so ADC noise at the edge does not
+    // toggle the motor power every frame.
+    const int band = s.mode == Mode::Holding ? 2 * cfg.servoTolerance : cfg.servoTolerance;
+    if (std::abs(error) <= band) {
+        s.mode = Mode::Holding;
+        return false;
+    }
+    if (s.mode != Mode::Driving) {
+        s.mode = Mode::Driving;
+        s.progressAt = now;
+        s.progressPos = measured;
+        s.progressError = std::abs(error);
+        send = true;
+        return true;
+    }
+    // Progress: the error shrank, or the lever travelled toward the target (a
+    // moving target can keep the error constant while the lever follows).
+    const int travelled = (measured - s.progressPos) * errorSign;
+    if (std::abs(error) + cfg.servoTolerance <= s.progressError || travelled >= std::max(1, cfg.servoTolerance)) {
+        s.progressAt = now;
+        s.progressPos = measured;
+        s.progressError = std::abs(error);
+    } else if (now - s.progressAt > std::chrono::milliseconds(cfg.servoStallMs)) {
+        s.mode = Mode::Stalled;
+        s.blockedTarget = motorTarget;
+        s.blockedUntil = now + std::chrono::milliseconds(cfg.servoRetryMs);
+        g_fscMetrics.servoStalls.add();
+        logLine(std::string("FSC: ") + name + " servo: stalled at " + std::to_string(measured) + " (target=" +
+                std::to_string(motorTarget) + "), motor off");
+        return false;
+    }
+    return true;
+}
+
+void processFscOutputs(const FscState& inputState) {
+    if (!fscIsConnected() || !g_fscProfileActive.load()) {
+        return;
+    }
+
+    bool parkLightAvailable = false;
+    bool parkLightOn = false;
+    {
+        const auto& mapping = g_fscProfileRuntime.indicators[static_cast<size_t>(FscIndicatorId::ParkingBrakeLight)];
+        if (mapping.defined && mapping.dataref) {
+            float value = 0.0f;
+            if (readDatarefValue(mapping.dataref, mapping.datarefType, value)) {
+                parkLightOn = value >= mapping.onMin;
+                if (mapping.invert) {
+                    parkLightOn = !parkLightOn;
+                }
+                parkLightAvailable = true;
             }
-            g_fscOut.parkBrakeLightKnown = true;
-            g_fscOut.parkBrakeLightOn = parkLightOn;
         }
+    }
+    const int parkLight = parkLightAvailable ? (parkLightOn ? 1 : 0) : -1;
+
+    bool motorizedHw = (g_prefs.fsc.type == Prefs::FscType::Motorized);
+    if (!motorizedHw || !g_fscProfileRuntime.motorized.enabled) {
+        std::lock_guard<std::mutex> lock(g_fscOutputMutex);
+        g_fscOutputIntent.digitalMask = -1;
+        g_fscOutputIntent.motorPower = -1;
+        g_fscOutputIntent.parkLight = parkLight;
+        g_fscTrimDuty = 0.0f;
         return;
     }
 
     const auto& motor = g_fscProfileRuntime.motorized;
     auto now = std::chrono::steady_clock::now();
 
+    // Speedbrake moves end when the reported lever reaches the target detent;
+    // hold_ms is only the timeout.
+    if (g_fscOut.speedbrakeMove) {
+        const long long elapsedMs =
+            std::chrono::duration_cast<std::chrono::milliseconds>(now - g_fscOut.speedbrakeMoveStart).count();
+        int sb = inputState.speedbrake;
+        if (sb >= 0 && g_prefs.fsc.speedBrakeReversed) {
+            sb = 255 - sb;
+        }
+        if (sb >= 0 && g_fscOut.speedbrakeMoveTarget >= 0 &&
+            std::abs(sb - g_fscOut.speedbrakeMoveTarget) <= motor.speedbrake.tolerance) {
+            logLine(std::string("FSC: speedbrake motor ") + g_fscOut.speedbrakeMove + " arrived after " +
+                    std::to_string(elapsedMs) + " ms (lever=" + std::to_string(sb) + ")");
+            g_fscOut.speedbrakeMotorOffTime = now;
+            g_fscOut.speedbrakeMove = nullptr;
+        } else if (now >= g_fscOut.speedbrakeMotorOffTime) {
+            if (g_fscOut.speedbrakeMoveTarget >= 0) {
+                logLine(std::string("FSC: speedbrake motor ") + g_fscOut.speedbrakeMove + " timed out after " +
+                        std::to_string(elapsedMs) + " ms (lever=" + std::to_string(sb) +
+                        ", target=" + std::to_string(g_fscOut.speedbrakeMoveTarget) + ")");
+            }
+            g_fscOut.speedbrakeMove = nullptr;
+        }
+    }
+
     // Decide if we are currently moving motorized speedbrake/trim indicator.
     bool speedbrakeMotorActive = now < g_fscOut.speedbrakeMotorOffTime;
     bool trimIndMotorActive = now < g_fscOut.trimIndMotorOffTime;
@@ -5599,7 +8106,6 @@ void processFscOutputs(const FscState& inputState) {
 
     // Digital state mask (solenoids/backlight/trim motor direction)
     uint8_t digitalMask = 0;
-    bool wroteDigital = false;
     bool onGround = false;
     if (motor.onGroundDataref) {
         float value = 0.0f;
@@ -5656,43 +8162,46 @@ void processFscOutputs(const FscState& inputState) {
         bool autoPilot = (inputState.stabTrim & 0x04) != 0;
         manualTrimMode = mainElec && autoPilot;
     }
-    if (!manualTrimMode && motor.trimIndicator.wheelDataref) {
-        float trimWheel = 0.0f;
-        if (!readDatarefValue(motor.trimIndicator.wheelDataref, motor.trimIndicator.wheelDatarefType, trimWheel)) {
-            trimWheel = 0.0f;
+    // The I/O thread pulses the direction bits (0x20 UP / 0x40 DOWN) with a duty
+    // proportional to the smoothed trim rate.
+    float trimDuty = 0.0f;
+    float trimWheel = 0.0f;
+    if (!manualTrimMode && motor.trimIndicator.wheelDataref &&
+        readDatarefValue(motor.trimIndicator.wheelDataref, motor.trimIndicator.wheelDatarefType, trimWheel) &&
+        std::isfinite(trimWheel)) {
+        const auto& cfg = motor.trimWheel;
+        float span = 1.0f;
+        float wheelMin = 0.0f;
+        float wheelMax = 0.0f;
+        if (getPrefFloatByKey(motor.trimIndicator.wheelMinRef, wheelMin) &&
+            getPrefFloatByKey(motor.trimIndicator.wheelMaxRef, wheelMax) && std::isfinite(wheelMin) &&
+            std::isfinite(wheelMax) && wheelMax != wheelMin) {
+            span = std::abs(wheelMax - wheelMin);
         }
         if (std::isfinite(g_fscOut.lastTrimWheel)) {
-            if (trimWheel > g_fscOut.lastTrimWheel + 0.0001f) {
-                digitalMask |= 0x20;  // trim wheel motor UP
-            } else if (trimWheel < g_fscOut.lastTrimWheel - 0.0001f) {
-                digitalMask |= 0x40;  // trim wheel motor DOWN
+            const float dt = std::chrono::duration<float>(now - g_fscOut.lastTrimTime).count();
+            if (dt > 0.0f) {
+                const float rate = (trimWheel - g_fscOut.lastTrimWheel) / span / dt;
+                const float alpha = cfg.smoothMs > 0 ? 1.0f - std::exp(-dt * 1000.0f / cfg.smoothMs) : 1.0f;
+                g_fscOut.trimRate += alpha * (rate - g_fscOut.trimRate);
             }
         }
         g_fscOut.lastTrimWheel = trimWheel;
-    }
-
-    if (digitalMask != g_fscOut.digitalMask) {
-        fscWriteFrame(0x87, 0x10, digitalMask);
-        g_fscOut.digitalMask = digitalMask;
-        wroteDigital = true;
-    }
-    if (parkLightChanged && !parkLightOn) {
-        // Some firmwares use 0x87 0x10 0x00 as park-brake-light OFF; reapply digital mask afterwards.
-        fscWriteFrame(0x87, 0x10, 0x00);
-        fscWriteFrame(0x87, 0x10, digitalMask);
-        wroteDigital = true;
-    }
-    if (parkLightOn && (parkLightChanged || wroteDigital)) {
-        // Restore desired park-brake-light state after any 0x87 0x10 write.
-        fscWriteFrame(0x87, 0x11, 0x00);
-    }
-    if (parkLightChanged) {
-        g_fscOut.parkBrakeLightKnown = true;
-        g_fscOut.parkBrakeLightOn = parkLightOn;
+        g_fscOut.lastTrimTime = now;
+        if (std::abs(g_fscOut.trimRate) >= cfg.deadband) {
+            trimDuty = std::clamp(g_fscOut.trimRate / cfg.fullRate, -cfg.maxDuty, cfg.maxDuty);
+        }
+    } else {
+        g_fscOut.lastTrimWheel = std::numeric_limits<float>::quiet_NaN();
+        g_fscOut.trimRate = 0.0f;
     }
 
     // Motorized throttle motors (follow Zibo thrust lever when autothrottle locks throttles).
     bool throttleMotors = false;
+    // Motor units (fsc.motor.throttleN_*) of lever ratio 0 and 1.
+    int motorMin[2] = {0, 0};
+    int motorMax[2] = {0, 0};
+    bool motorRange = false;
     int motorThr1 = g_fscOut.motorThrottle1Pos;
     int motorThr2 = g_fscOut.motorThrottle2Pos;
     if (motor.throttleFollow.lockDataref && motor.throttleFollow.armDataref && motor.throttleFollow.leverDataref) {
@@ -5715,29 +8224,99 @@ void processFscOutputs(const FscState& inputState) {
                     float norm = clamp01(lever);
                     motorThr1 = static_cast<int>(std::lround(t1Min + (t1Max - t1Min) * norm));
                     motorThr2 = static_cast<int>(std::lround(t2Min + (t2Max - t2Min) * norm));
+                    motorMin[0] = t1Min;
+                    motorMax[0] = t1Max;
+                    motorMin[1] = t2Min;
+                    motorMax[1] = t2Max;
+                    motorRange = true;
                 }
             }
         }
     }
     g_fscMotorThrottleActive.store(throttleMotors);
 
-    if (throttleMotors) {
-        float updateRate = 0.0f;
-        if (!getPrefFloatByKey(motor.throttleFollow.updateRateRef, updateRate)) {
-            updateRate = 0.07f;
+    // Closed loop: a lever is driven (and powered) only while its reported
+    // position is outside the servo tolerance; a stall or a pilot override cuts
+    // its power until the target moves on or servo_retry_ms passes. The lever
+    // position is compared in motor units (fscThrottleMotorForLever). Levers
+    // without feedback (no calibration/axis or no packet yet) stay open loop.
+    std::array<bool, 2> throttlePower{throttleMotors, throttleMotors};
+    std::array<bool, 2> throttleSend{false, false};
+    if (throttleMotors && motor.throttleFollow.servo) {
+        const int measured[2] = {inputState.throttle1, inputState.throttle2};
+        const int targets[2] = {motorThr1, motorThr2};
+        const FscAxisId axes[2] = {FscAxisId::Throttle1, FscAxisId::Throttle2};
+        const char* const names[2] = {"throttle1", "throttle2"};
+        for (size_t i = 0; i < 2; ++i) {
+            float lever = 0.0f;
+            if (!motorRange || !fscThrottleMotorForLever(g_fscProfileRuntime.axes[static_cast<size_t>(axes[i])],
+                                                         motorMin[i], motorMax[i], measured[i], lever)) {
+                continue;
+            }
+            throttlePower[i] = stepFscThrottleServo(g_fscOut.throttleServo[i], names[i],
+                                                    static_cast<int>(std::lround(lever)), targets[i],
+                                                    motor.throttleFollow, now, throttleSend[i]);
         }
-        if (g_fscOut.lastThrottleUpdate.time_since_epoch().count() == 0 ||
-            now - g_fscOut.lastThrottleUpdate > std::chrono::duration<float>(updateRate)) {
-            if (motorThr1 != g_fscOut.motorThrottle1Pos) {
-                fscWritePosition(0x00, motorThr1);
-                g_fscOut.motorThrottle1Pos = motorThr1;
+    } else {
+        g_fscOut.throttleServo = {};
+    }
+
+    // The I/O thread writes the targets (ramped with motion profiles); without
+    // profiles update_rate_ref limits how often a throttle target is written.
+    // A new drive starts from the reported lever position in motor units
+    // (fscThrottleMotorForLever, as the servo sees it).
+    {
+        int intervalMs = 0;
+        if (!motor.motion.enabled) {
+            float updateRate = 0.0f;
+            if (!getPrefFloatByKey(motor.throttleFollow.updateRateRef, updateRate)) {
+                updateRate = 0.07f;
+            }
+            intervalMs = static_cast<int>(std::lround(updateRate * 1000.0f));
+        }
+        const int measured[2] = {inputState.throttle1, inputState.throttle2};
+        const int targets[2] = {motorThr1, motorThr2};
+        const FscMotor motors[2] = {FscMotor::Throttle1, FscMotor::Throttle2};
+        const FscAxisId axes[2] = {FscAxisId::Throttle1, FscAxisId::Throttle2};
+        for (size_t i = 0; i < 2; ++i) {
+            setFscMotorMinInterval(motors[i], intervalMs);
+            if (!throttleMotors || !throttlePower[i]) {
+                if (g_fscOut.throttleMotion[i]) {
+                    setFscMotorTarget(motors[i], -1);
+                    g_fscOut.throttleMotion[i] = false;
+                }
+                continue;
+            }
+            const bool restart = throttleSend[i] || !g_fscOut.throttleMotion[i];
+            int startFrom = -1;
+            float lever = 0.0f;
+            if (restart && motorRange &&
+                fscThrottleMotorForLever(g_fscProfileRuntime.axes[static_cast<size_t>(axes[i])], motorMin[i],
+                                         motorMax[i], measured[i], lever)) {
+                startFrom = static_cast<int>(std::lround(lever));
             }
-            if (motorThr2 != g_fscOut.motorThrottle2Pos) {
-                fscWritePosition(0x10, motorThr2);
-                g_fscOut.motorThrottle2Pos = motorThr2;
+            setFscMotorTarget(motors[i], targets[i], startFrom);
+            g_fscOut.throttleMotion[i] = true;
+        }
+        if (throttleMotors) {
+            g_fscOut.motorThrottle1Pos = motorThr1;
+            g_fscOut.motorThrottle2Pos = motorThr2;
+        }
+
+        // The governor (I/O thread) may hold a throttle motor off; the lever
+        // then stops following A/T until it is released.
+        const int heldOff = throttleMotors ? (g_fscMotorPowerDenied.load() & 0x03) : 0;
+        const char* const names[2] = {"throttle1", "throttle2"};
+        for (size_t i = 0; i < 2; ++i) {
+            const int bit = 1 << i;
+            if ((heldOff & bit) && !(g_fscOut.throttleHeldOff & bit)) {
+                logLine(std::string("FSC: ") + names[i] +
+                        " motor held off by the output governor, A/T lever following suspended");
+            } else if (!(heldOff & bit) && (g_fscOut.throttleHeldOff & bit) && throttleMotors) {
+                logLine(std::string("FSC: ") + names[i] + " A/T lever following resumed");
             }
-            g_fscOut.lastThrottleUpdate = now;
         }
+        g_fscOut.throttleHeldOff = heldOff;
     }
 
     // Motorized speedbrake auto deploy/stow (moves physical lever).
@@ -5758,27 +8337,39 @@ void processFscOutputs(const FscState& inputState) {
             getPrefIntByKey(motor.speedbrake.upRef, upRef) &&
             getPrefIntByKey(motor.speedbrake.motorDownRef, motorDown) &&
             getPrefIntByKey(motor.speedbrake.motorUpRef, motorUp)) {
+            // A move ramps from the reported lever, mapped from down_ref..up_ref
+            // (calibration units) onto motor_down..motor_up. Without down_ref
+            // there is no feedback and the planner continues from its own
+            // position (the first move after a connect is not ramped).
+            int downRef = -1;
+            if (motor.speedbrake.downRef.empty() || !getPrefIntByKey(motor.speedbrake.downRef, downRef)) {
+                downRef = -1;
+            }
+            int startFrom = -1;
+            if (downRef >= 0 && upRef != downRef) {
+                const float f = clamp01(static_cast<float>(sb - downRef) / static_cast<float>(upRef - downRef));
+                startFrom = static_cast<int>(std::lround(motorDown + (motorUp - motorDown) * f));
+            }
             if (ratio >= motor.speedbrake.ratioUpMin && std::abs(sb - armRef) <= motor.speedbrake.tolerance) {
                 g_fscOut.motorSpeedbrakePos = motorUp;
-                fscWritePosition(0x20, g_fscOut.motorSpeedbrakePos);
+                setFscMotorTarget(FscMotor::Speedbrake, g_fscOut.motorSpeedbrakePos, startFrom, true);
                 g_fscOut.speedbrakeMotorOffTime = now + std::chrono::milliseconds(motor.speedbrake.holdMs);
+                g_fscOut.speedbrakeMoveStart = now;
+                g_fscOut.speedbrakeMoveTarget = upRef;
+                g_fscOut.speedbrakeMove = "deploy";
                 speedbrakeMotorActive = true;
                 digitalMask |= 0x04;
             } else if (ratio <= motor.speedbrake.ratioDownMax && std::abs(sb - upRef) <= motor.speedbrake.tolerance) {
                 g_fscOut.motorSpeedbrakePos = motorDown;
-                fscWritePosition(0x20, g_fscOut.motorSpeedbrakePos);
+                setFscMotorTarget(FscMotor::Speedbrake, g_fscOut.motorSpeedbrakePos, startFrom, true);
                 g_fscOut.speedbrakeMotorOffTime = now + std::chrono::milliseconds(motor.speedbrake.holdMs);
+                g_fscOut.speedbrakeMoveStart = now;
+                g_fscOut.speedbrakeMoveTarget = downRef;
+                g_fscOut.speedbrakeMove = "stow";
                 speedbrakeMotorActive = true;
                 digitalMask |= 0x04;
             }
         }
-        if (speedbrakeMotorActive && digitalMask != g_fscOut.digitalMask) {
-            fscWriteFrame(0x87, 0x10, digitalMask);
-            g_fscOut.digitalMask = digitalMask;
-            if (parkLightOn) {
-                fscWriteFrame(0x87, 0x11, 0x00);
-            }
-        }
     }
     g_fscMotorSpeedbrakeActive.store(speedbrakeMotorActive);
 
@@ -5799,9 +8390,23 @@ void processFscOutputs(const FscState& inputState) {
                 norm = clamp01(norm);
                 int target = static_cast<int>(std::lround(arrowMin + (arrowMax - arrowMin) * norm));
                 target = std::clamp(target, std::min(arrowMin, arrowMax), std::max(arrowMin, arrowMax));
-                if (target != g_fscOut.motorTrimIndPos) {
+                // Batched retargeting: while the trim moves, the arrow is retargeted
+                // at most every min_interval_ms and only for changes beyond the
+                // deadband; once the target holds still that long it is sent exactly.
+                if (target != g_fscOut.trimIndPending) {
+                    g_fscOut.trimIndPending = target;
+                    g_fscOut.trimIndPendingSince = now;
+                }
+                const auto minInterval = std::chrono::milliseconds(motor.trimIndicator.minIntervalMs);
+                const int diff = std::abs(target - g_fscOut.motorTrimIndPos);
+                const bool first = g_fscOut.motorTrimIndPos < 0;
+                const bool moving = diff > motor.trimIndicator.deadband && now - g_fscOut.trimIndLastWrite >= minInterval;
+                const bool settled = diff > 0 && now - g_fscOut.trimIndPendingSince >= minInterval;
+                if (first || moving || settled) {
                     g_fscOut.motorTrimIndPos = target;
-                    fscWritePosition(0x30, target);
+                    g_fscOut.trimIndLastWrite = now;
+                    setFscMotorTarget(FscMotor::TrimIndicator, target, -1, true);
+                    g_fscMetrics.trimIndicatorWrites.add();
                     g_fscOut.trimIndMotorOffTime = now + std::chrono::milliseconds(motor.trimIndicator.holdMs);
                     trimIndMotorActive = true;
                 }
@@ -5812,22 +8417,540 @@ void processFscOutputs(const FscState& inputState) {
 
     // Motor power mask
     uint8_t motorPower = 0;
-    if (throttleMotors) motorPower |= 0x01 | 0x02;
+    if (throttlePower[0]) motorPower |= 0x01;
+    if (throttlePower[1]) motorPower |= 0x02;
     if (speedbrakeMotorActive) motorPower |= 0x04;
     if (trimIndMotorActive) motorPower |= 0x08;
-    if (motorPower != g_fscOut.motorPowerMask) {
-        fscWriteFrame(0x93, 0x00, motorPower);
-        g_fscOut.motorPowerMask = motorPower;
+
+    std::lock_guard<std::mutex> lock(g_fscOutputMutex);
+    g_fscOutputIntent.digitalMask = digitalMask;
+    g_fscOutputIntent.motorPower = motorPower;
+    g_fscOutputIntent.parkLight = parkLight;
+    g_fscTrimDuty = trimDuty;
+    g_fscTrimPwmMs = motor.trimWheel.pwmMs;
+}
+
+// Fast-start acquisition: after connect, poll rapidly until every channel the
+// profile needs has reported once, then fall back to the 1 s keepalive poll.
+static bool fscUpdateAcquisition(std::chrono::steady_clock::time_point started,
+                                 std::chrono::steady_clock::time_point now,
+                                 int polls) {
+    constexpr auto kAcquireTimeout = std::chrono::seconds(3);
+    const uint32_t required = g_fscRequiredChannels.load();
+    uint32_t seen = 0;
+    bool timedOut = false;
+    {
+        std::lock_guard<std::mutex> lock(g_fscMutex);
+        seen = g_fscState.seen;
+        if ((seen & required) != required) {
+            if (now - started < kAcquireTimeout) {
+                return false;
+            }
+            timedOut = true;
+        }
+        g_fscState.complete = true;
+    }
+    const long long ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - started).count();
+    if (timedOut) {
+        logLine("FSC: input state incomplete after " + std::to_string(ms) + " ms (missing=" +
+                hexByte(static_cast<uint8_t>(required & ~seen)) + ", polls=" + std::to_string(polls) +
+                "), continuing with partial state");
+    } else {
+        logLine("FSC: complete input state after " + std::to_string(ms) + " ms (polls=" + std::to_string(polls) + ")");
     }
+    return true;
 }
 
+std::atomic<bool> g_fscLinkReportRequested{false};
+
+// I/O thread: rate/accel/jerk-limited trajectories toward the motor targets set
+// by setFscMotorTarget(). Every periodMs each moving motor gets its next
+// intermediate position; a target is approached with a braking velocity
+// sqrt(2*accel*distance), so the lever slows down before it arrives.
+struct FscMotionPlanner {
+    struct Axis {
+        bool known = false;  // position is meaningful (a move ran or startFrom was given)
+        double pos = 0.0;
+        double vel = 0.0;
+        double acc = 0.0;
+        int written = -1;  // last position written in the current drive
+        uint32_t drive = 0;
+        std::chrono::steady_clock::time_point lastWrite{};
+    };
+    std::array<Axis, kFscMotorCount> axes{};
+    uint32_t version = 0;
+    std::chrono::steady_clock::time_point lastTick{};
+
+    void reset() {
+        axes = {};
+        lastTick = {};
+    }
+
+    static void step(Axis& a, double target, const FscMotorLimits& lim, double dt) {
+        const double err = target - a.pos;
+        const double dir = (err > 0.0) - (err < 0.0);
+        if (lim.maxRate <= 0.0f && lim.maxAccel <= 0.0f) {
+            a.pos = target;
+            a.vel = 0.0;
+            a.acc = 0.0;
+            return;
+        }
+        double vDes = std::abs(err) / dt;
+        if (lim.maxRate > 0.0f) {
+            vDes = std::min(vDes, static_cast<double>(lim.maxRate));
+        }
+        if (lim.maxAccel > 0.0f) {
+            vDes = std::min(vDes, std::sqrt(2.0 * lim.maxAccel * std::abs(err)));
+        }
+        vDes *= dir;
+        if (lim.maxAccel > 0.0f) {
+            double accDes = std::clamp((vDes - a.vel) / dt, -static_cast<double>(lim.maxAccel),
+                                       static_cast<double>(lim.maxAccel));
+            if (lim.maxJerk > 0.0f) {
+                const double dj = lim.maxJerk * dt;
+                accDes = std::clamp(accDes, a.acc - dj, a.acc + dj);
+            }
+            a.acc = accDes;
+            a.vel += a.acc * dt;
+        } else {
+            a.acc = 0.0;
+            a.vel = vDes;
+        }
+        a.pos += a.vel * dt;
+        const double after = target - a.pos;
+        if (std::abs(after) < 0.5 || (after > 0.0) != (err > 0.0)) {
+            a.pos = target;  // arrived or overshot: settle on the target
+            a.vel = 0.0;
+            a.acc = 0.0;
+        }
+    }
+
+    // Writes at most |budget| target frames; the rest wait for the next tick.
+    void tick(std::chrono::steady_clock::time_point now, int& budget) {
+        const auto period = std::chrono::milliseconds(g_fscMotionPeriodMs.load());
+        if (lastTick.time_since_epoch().count() != 0 && now - lastTick < period) {
+            return;
+        }
+        FscMotionShared shared;
+        {
+            std::lock_guard<std::mutex> lock(g_fscMotionMutex);
+            shared = g_fscMotion;
+            g_fscMotion.startFrom.fill(-1);
+        }
+        if (shared.version != version) {
+            reset();
+            version = shared.version;
+        }
+        if (!shared.enabled) {
+            return;
+        }
+        double dt = std::chrono::duration<double>(period).count();
+        if (lastTick.time_since_epoch().count() != 0) {
+            dt = std::min(std::chrono::duration<double>(now - lastTick).count(), 4.0 * dt);
+        }
+        lastTick = now;
+        for (size_t i = 0; i < kFscMotorCount; ++i) {
+            Axis& a = axes[i];
+            if (shared.drive[i] != a.drive) {
+                a.drive = shared.drive[i];
+                a.written = -1;
+            }
+            if (shared.startFrom[i] >= 0) {
+                a.known = true;
+                a.pos = shared.startFrom[i];
+                a.vel = 0.0;
+                a.acc = 0.0;
+                a.written = -1;
+            }
+            const int target = shared.target[i];
+            if (target < 0) {
+                a.vel = 0.0;
+                a.acc = 0.0;
+                a.written = -1;
+                continue;
+            }
+            if (!a.known) {
+                a.known = true;  // no position and no feedback: the first target is written as is
+                a.pos = target;
+            } else if (a.pos != target || a.vel != 0.0) {
+                step(a, target, shared.limits[i], dt);
+            }
+            const int out = static_cast<int>(std::lround(a.pos));
+            if (out == a.written ||
+                (a.written >= 0 && now - a.lastWrite < std::chrono::milliseconds(shared.minIntervalMs[i]))) {
+                continue;
+            }
+            if (budget <= 0) {
+                g_fscMetrics.outputDeferred.add();
+                continue;
+            }
+            fscWritePosition(kFscMotorBase[i], out);
+            a.written = out;
+            a.lastWrite = now;
+            --budget;
+        }
+    }
+
+    // 0x93 bits of the motors that have written a position in their current
+    // drive; a motor without one would be powered toward the firmware's old target.
+    int readyMask() const {
+        std::lock_guard<std::mutex> lock(g_fscMotionMutex);
+        int mask = 0;
+        for (size_t i = 0; i < kFscMotorCount; ++i) {
+            if (axes[i].written >= 0 && axes[i].drive == g_fscMotion.drive[i]) {
+                mask |= 1 << i;
+            }
+        }
+        return mask;
+    }
+};
+
+// I/O thread: limits what the 0x93 power mask may switch on. A motor whose
+// powered share of the last motor_duty_window_sec (exponential average)
+// reaches motor_duty_pct is held off until it is 10 points below; at most
+// max_motors are powered at once, picked in priority order.
+struct FscMotorGovernor {
+    struct Motor {
+        uint8_t bit;
+        const char* name;
+    };
+    // Priority order: the speedbrake (auto-stow after touchdown) first.
+    static constexpr std::array<Motor, 4> kMotors{{
+        {0x04, "speedbrake"}, {0x01, "throttle1"}, {0x02, "throttle2"}, {0x08, "trim_indicator"}}};
+
+    std::array<double, 4> duty{};
+    std::array<bool, 4> cooling{};
+    int denied = 0;  // requested bits held back by the last apply()
+    std::chrono::steady_clock::time_point last{};
+
+    void reset() {
+        duty = {};
+        cooling = {};
+        denied = 0;
+        last = {};
+    }
+
+    // |powered| = mask confirmed since the previous call; returns the allowed part of |requested|.
+    int apply(int requested, int powered, std::chrono::steady_clock::time_point now) {
+        const double limit = g_prefs.fsc.motorDutyPct / 100.0;
+        double alpha = 0.0;
+        if (last.time_since_epoch().count() != 0) {
+            const double dt = std::chrono::duration<double>(now - last).count();
+            alpha = 1.0 - std::exp(-dt / g_prefs.fsc.motorDutyWindowSec);
+        }
+        last = now;
+        int allowed = 0;
+        int count = 0;
+        for (size_t i = 0; i < kMotors.size(); ++i) {
+            const auto& m = kMotors[i];
+            duty[i] += alpha * (((powered >= 0 && (powered & m.bit)) ? 1.0 : 0.0) - duty[i]);
+            if (limit < 1.0 && !cooling[i] && duty[i] >= limit) {
+                cooling[i] = true;
+                logLine(std::string("FSC: governor: ") + m.name + " powered " +
+                        std::to_string(static_cast<int>(duty[i] * 100.0 + 0.5)) + "% of the last " +
+                        std::to_string(g_prefs.fsc.motorDutyWindowSec) + " s, held off to cool down");
+            } else if (cooling[i] && duty[i] < limit - 0.1) {
+                cooling[i] = false;
+                logLine(std::string("FSC: governor: ") + m.name + " released");
+            }
+            if ((requested & m.bit) && !cooling[i] && count < g_prefs.fsc.maxMotors) {
+                allowed |= m.bit;
+                ++count;
+            }
+        }
+        const int nowDenied = requested & ~allowed & 0x0F;
+        for (const auto& m : kMotors) {
+            if ((nowDenied & m.bit) && !(denied & m.bit)) {
+                g_fscMetrics.motorPowerDenied.add();
+            }
+        }
+        denied = nowDenied;
+        g_fscMotorPowerDenied.store(nowDenied);
+        return (requested & ~0x0F) | allowed;
+    }
+};
+
+// I/O thread: turns the published output intent into frames every
+// fsc.output_period_ms, independent of the sim frame rate. Order is priority:
+// motor power off, motor targets, motor power on, then indicators (0x87). A
+// per-tick frame budget derived from the baud rate keeps a burst of targets
+// from saturating the line; power frames are never held back.
+struct FscOutputScheduler {
+    static constexpr auto kIndicatorInterval = std::chrono::milliseconds(20);
+
+    FscMotionPlanner motion;
+    std::chrono::steady_clock::time_point lastTick{};
+    std::chrono::steady_clock::time_point lastIndicators{};
+    FscHwOutputs confirmed;  // as last accepted by the port; unknown after connect
+    std::chrono::steady_clock::time_point trimPulseStart{};
+    FscMotorGovernor governor;
+    double txTokens = 0.0;  // bytes the output frames may still send (token bucket)
+
+    void reset() {
+        motion.reset();
+        governor.reset();
+        g_fscMotorPowerDenied.store(0);
+        txTokens = 0.0;
+        lastTick = {};
+        lastIndicators = {};
+        confirmed = FscHwOutputs{};
+        trimPulseStart = {};
+    }
+
+    // Trim wheel direction bits for this tick: on for |duty| of each pulse period.
+    int trimWheelBits(float duty, int pwmMs, std::chrono::steady_clock::time_point now) {
+        const auto period = std::chrono::milliseconds(pwmMs);
+        if (duty == 0.0f) {
+            trimPulseStart = {};
+            return 0;
+        }
+        if (trimPulseStart.time_since_epoch().count() == 0 || now - trimPulseStart >= period) {
+            trimPulseStart = now;
+        }
+        const auto onTime = std::chrono::duration<float, std::milli>(std::abs(duty) * pwmMs);
+        if (now - trimPulseStart >= onTime) {
+            return 0;
+        }
+        return duty > 0.0f ? 0x20 : 0x40;
+    }
+
+    // Frames this tick may send: tx_budget_pct of the line (10 bits per byte,
+    // 3 bytes per frame), saved up for at most four ticks.
+    int frameBudget(double dtSec) {
+        const double bytesPerSec = g_prefs.fsc.serial.baud / 10.0 * g_prefs.fsc.txBudgetPct / 100.0;
+        const double burst = std::max(6.0, bytesPerSec * g_prefs.fsc.outputPeriodMs / 1000.0 * 4.0);
+        txTokens = std::min(burst, txTokens + bytesPerSec * dtSec);
+        return static_cast<int>(txTokens / 3.0);
+    }
+
+    // Reconciles the |desired| fields; returns the number of frames written.
+    int reconcile(const FscHwOutputs& desired) {
+        std::array<FscOutputFrame, 4> frames{};
+        const size_t n = reconcileFscOutputs(confirmed, desired, kFscOutputQuirks, frames);
+        for (size_t i = 0; i < n; ++i) {
+            if (!fscWriteFrame(frames[i].a, frames[i].b, frames[i].c)) {
+                confirmed = FscHwOutputs{};
+                return static_cast<int>(i);
+            }
+            applyFscOutputFrame(confirmed, frames[i], kFscOutputQuirks);
+        }
+        return static_cast<int>(n);
+    }
+
+    void tick(std::chrono::steady_clock::time_point now) {
+        if (lastTick.time_since_epoch().count() != 0 &&
+            now - lastTick < std::chrono::milliseconds(g_prefs.fsc.outputPeriodMs)) {
+            return;
+        }
+        const double dtSec = lastTick.time_since_epoch().count() != 0
+                                 ? std::chrono::duration<double>(now - lastTick).count()
+                                 : g_prefs.fsc.outputPeriodMs / 1000.0;
+        lastTick = now;
+        FscHwOutputs desired;
+        float trimDuty = 0.0f;
+        int trimPwmMs = 200;
+        {
+            std::lock_guard<std::mutex> lock(g_fscOutputMutex);
+            desired = g_fscOutputIntent;
+            trimDuty = g_fscTrimDuty;
+            trimPwmMs = g_fscTrimPwmMs;
+        }
+        if (desired.digitalMask >= 0) {
+            desired.digitalMask = (desired.digitalMask & ~0x60) | trimWheelBits(trimDuty, trimPwmMs, now);
+        }
+        if (desired.motorPower >= 0) {
+            desired.motorPower = governor.apply(desired.motorPower, confirmed.motorPower, now);
+        }
+        const int budgetStart = frameBudget(dtSec);
+        int budget = budgetStart;
+
+        // Switching a motor off never waits behind anything else (and is not
+        // held back by the budget). Switching one on is sent after the targets,
+        // and only once the planner has written a position of the motor's
+        // current drive (the planner runs every motion period_ms and its writes
+        // share the budget), so it never drives toward a stale one.
+        FscHwOutputs power;
+        power.motorPower = desired.motorPower;
+        const bool powerOff = desired.motorPower >= 0 && confirmed.motorPower >= 0 &&
+                              (desired.motorPower & ~confirmed.motorPower) == 0;
+        if (powerOff) {
+            budget -= reconcile(power);
+        }
+        if (g_fscMotionEnabled.load()) {
+            motion.tick(now, budget);
+            if (!powerOff && desired.motorPower >= 0) {
+                const int wasOn = confirmed.motorPower >= 0 ? confirmed.motorPower : 0;
+                const int waiting = desired.motorPower & ~wasOn & ~motion.readyMask() & 0x0F;
+                if (waiting != 0) {
+                    power.motorPower = desired.motorPower & ~waiting;
+                    g_fscMetrics.outputDeferred.add();
+                }
+            }
+        }
+        if (!powerOff) {
+            budget -= reconcile(power);
+        }
+
+        FscHwOutputs indicators = desired;
+        indicators.motorPower = -1;
+        std::array<FscOutputFrame, 4> frames{};
+        const size_t pending = reconcileFscOutputs(confirmed, indicators, kFscOutputQuirks, frames);
+        if (pending > 0 && now - lastIndicators >= kIndicatorInterval) {
+            if (budget < static_cast<int>(pending)) {
+                g_fscMetrics.outputDeferred.add();
+            } else {
+                lastIndicators = now;
+                budget -= reconcile(indicators);
+            }
+        }
+        txTokens = std::max(-6.0, txTokens - 3.0 * (budgetStart - budget));
+    }
+};
+
+// Serial link quality, owned by the I/O thread: per-command inter-arrival
+// histograms, RX gaps, framing errors (a byte without the 0x80 start bit where
+// a packet start was expected) and second-byte timeouts. Reported every
+// fsc.link_report_sec and on FSCB738TQ/fsc_link_report; each report covers
+// the time since the previous one.
+struct FscLinkQuality {
+    std::chrono::steady_clock::time_point windowStart{};
+    std::chrono::steady_clock::time_point lastByte{};
+    std::array<std::chrono::steady_clock::time_point, kFscCommandSlots> lastPacket{};
+    std::array<std::unique_ptr<FscLatencyHistogram>, kFscCommandSlots> intervals{};
+    std::array<uint64_t, kFscCommandSlots> packets{};
+    uint64_t framingErrors = 0;
+    uint64_t secondByteTimeouts = 0;
+    uint64_t badReads = 0;
+    uint64_t unknown = 0;
+    uint64_t gaps = 0;
+    uint64_t maxGapNs = 0;
+
+    void reset(std::chrono::steady_clock::time_point now) {
+        windowStart = now;
+        for (auto& h : intervals) {
+            if (h) {
+                *h = FscLatencyHistogram{};
+            }
+        }
+        packets.fill(0);
+        framingErrors = secondByteTimeouts = badReads = unknown = gaps = maxGapNs = 0;
+    }
+
+    // A (re)connect starts a new timing baseline; silence while closed is no gap.
+    void onConnect() {
+        lastByte = {};
+        lastPacket.fill({});
+    }
+
+    void onByte(std::chrono::steady_clock::time_point now) {
+        if (lastByte.time_since_epoch().count() != 0) {
+            const auto gap = now - lastByte;
+            if (gap > std::chrono::milliseconds(g_prefs.fsc.linkGapMs)) {
+                ++gaps;
+                g_fscMetrics.rxGaps.add();
+                maxGapNs = std::max<uint64_t>(maxGapNs, static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(gap).count()));
+            }
+        }
+        lastByte = now;
+    }
+
+    void onPacket(uint8_t cmd, std::chrono::steady_clock::time_point now) {
+        const size_t slot = cmd >> 1;
+        ++packets[slot];
+        auto& last = lastPacket[slot];
+        if (last.time_since_epoch().count() != 0) {
+            if (!intervals[slot]) {
+                intervals[slot] = std::make_unique<FscLatencyHistogram>();
+            }
+            intervals[slot]->record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(now - last).count()));
+        }
+        last = now;
+    }
+
+    void onFramingError() {
+        ++framingErrors;
+        g_fscMetrics.framingErrors.add();
+    }
+
+    void onSecondByteTimeout() {
+        ++secondByteTimeouts;
+        g_fscMetrics.secondByteTimeouts.add();
+    }
+
+    void report(std::chrono::steady_clock::time_point now, const char* why) {
+        const double secs = std::chrono::duration<double>(now - windowStart).count();
+        uint64_t total = 0;
+        for (uint64_t n : packets) {
+            total += n;
+        }
+        std::ostringstream oss;
+        oss << std::fixed << std::setprecision(1) << "FSC LINK (" << why << "): " << secs << " s, packets=" << total
+            << " (" << (secs > 0.0 ? static_cast<double>(total) / secs : 0.0) << "/s), framing errors="
+            << framingErrors << " (" << std::setprecision(2)
+            << (total + framingErrors > 0
+                    ? 100.0 * static_cast<double>(framingErrors) / static_cast<double>(total + framingErrors)
+                    : 0.0)
+            << "%), 2nd-byte timeouts=" << secondByteTimeouts << ", bad reads=" << badReads
+            << ", unknown=" << unknown << ", gaps>" << g_prefs.fsc.linkGapMs << "ms=" << gaps;
+        if (gaps > 0) {
+            oss << " (max " << maxGapNs / 1000000 << " ms)";
+        }
+        logLine(oss.str());
+        for (size_t slot = 0; slot < kFscCommandSlots; ++slot) {
+            if (packets[slot] == 0) {
+                continue;
+            }
+            const uint8_t cmd = static_cast<uint8_t>(slot << 1);
+            std::ostringstream line;
+            line << "FSC LINK: " << hexByte(cmd) << " " << fscCommandDesc(cmd).name << " n=" << packets[slot];
+            const auto* h = intervals[slot].get();
+            if (h && h->total > 0) {
+                const double p50 = static_cast<double>(h->percentile(50.0)) / 1e6;
+                const double p99 = static_cast<double>(h->percentile(99.0)) / 1e6;
+                line << std::fixed << std::setprecision(1) << " interval p50=" << p50 << " p99=" << p99
+                     << " max=" << static_cast<double>(h->maxNs) / 1e6 << " ms jitter(p99-p50)=" << (p99 - p50)
+                     << " ms";
+            }
+            logLine(line.str());
+        }
+        reset(now);
+    }
+
+    void maybeReport(std::chrono::steady_clock::time_point now) {
+        if (g_fscLinkReportRequested.exchange(false)) {
+            report(now, "request");
+        } else if (g_prefs.fsc.linkReportSec > 0 &&
+                   now - windowStart >= std::chrono::seconds(g_prefs.fsc.linkReportSec)) {
+            report(now, "periodic");
+        }
+    }
+};
+
 void fscLoop() {
+    setFscTraceThreadName("fsc_io");
+    constexpr auto kPollInterval = std::chrono::seconds(1);
+    constexpr auto kBurstPollInterval = std::chrono::milliseconds(50);
     auto lastPoll = std::chrono::steady_clock::now();
     auto lastRx = std::chrono::steady_clock::now();
     auto lastDiag = std::chrono::steady_clock::now();
     uint64_t packets = 0;
     uint64_t badReads = 0;
-    std::array<bool, 128> unknownLogged{};
+    std::array<bool, kFscCommandSlots> censusLogged{};  // unknown/foreign commands logged once per run
+    FscLinkQuality link;
+    link.reset(std::chrono::steady_clock::now());
+    FscOutputScheduler outputs;
+    bool connectedBefore = false;
+    bool acquiring = false;
+    auto acquireStart = std::chrono::steady_clock::time_point{};
+    int acquirePolls = 0;
+    auto pollInterval = [&]() -> std::chrono::steady_clock::duration {
+        if (acquiring) {
+            return kBurstPollInterval;
+        }
+        return kPollInterval;
+    };
     bool rawCaptureActive = false;
     auto rawCaptureUntil = std::chrono::steady_clock::time_point{};
     auto rawLastFlush = std::chrono::steady_clock::time_point{};
@@ -5865,9 +8988,14 @@ void fscLoop() {
     };
 
     while (g_fscRunning.load()) {
+        link.maybeReport(std::chrono::steady_clock::now());
         intptr_t currentHandle = g_fscFd.load();
         if (currentHandle < 0) {
-            intptr_t openedHandle = openFscPort(g_prefs.fsc.port, g_prefs.fsc.serial);
+            intptr_t openedHandle = -1;
+            {
+                FscTraceScope trace("open_port");
+                openedHandle = openFscPort(g_prefs.fsc.port, g_prefs.fsc.serial);
+            }
             if (openedHandle < 0) {
 #if IBM
                 DWORD e = GetLastError();
@@ -5878,6 +9006,7 @@ void fscLoop() {
                 logLine("FSC: failed to open port " + g_prefs.fsc.port + " (" + std::to_string(e) + "): " +
                         std::strerror(e));
 #endif
+                FscTraceScope trace("reconnect_sleep");
                 std::this_thread::sleep_for(std::chrono::seconds(2));
                 continue;
             }
@@ -5887,10 +9016,29 @@ void fscLoop() {
             }
             logLine("FSC: opened " + g_prefs.fsc.port);
             logLine("FSC: serial " + fscSerialSummary(g_prefs.fsc.serial));
+            g_fscMetrics.connected.set(1);
+            if (connectedBefore) {
+                g_fscMetrics.reconnects.add();
+                triggerFscRecorder(kFscRecReconnect, g_prefs.fsc.port);
+            }
+            connectedBefore = true;
+            link.onConnect();
+            outputs.reset();
             startRawCapture();
+            {
+                std::lock_guard<std::mutex> lock(g_fscMutex);
+                g_fscState.seen = 0;
+                g_fscState.complete = false;
+                g_fscState.sampleValue.fill(-1.0f);  // restarts predictor history and filter chains
+                g_fscState.prevValue.fill(-1.0f);
+                g_fscState.filterValue.fill(-1.0f);
+            }
             fscSendPoll();
             lastPoll = std::chrono::steady_clock::now();
             lastRx = lastPoll;
+            acquiring = true;
+            acquireStart = lastPoll;
+            acquirePolls = 1;
         }
 
         uint8_t b1 = 0;
@@ -5899,9 +9047,18 @@ void fscLoop() {
             std::this_thread::sleep_for(std::chrono::milliseconds(50));
             continue;
         }
-        int r1 = readByteWithTimeout(currentHandle, b1, 500);
+        outputs.tick(std::chrono::steady_clock::now());
+        advanceFscAxisFilters(std::chrono::steady_clock::now());
+        int r1 = 0;
+        {
+            FscTraceScope trace("read");
+            r1 = readByteWithTimeout(currentHandle, b1, std::min(acquiring ? 20 : 500, g_prefs.fsc.outputPeriodMs));
+        }
         if (r1 == 0) {
             auto now = std::chrono::steady_clock::now();
+            if (acquiring && fscUpdateAcquisition(acquireStart, now, acquirePolls)) {
+                acquiring = false;
+            }
             if (rawCaptureActive && now > rawCaptureUntil) {
                 flushRaw(now, true);
             }
@@ -5912,14 +9069,20 @@ void fscLoop() {
                         "s (packets=" + std::to_string(packets) + ", bad_reads=" + std::to_string(badReads) + ")");
                 lastDiag = now;
             }
-            if (now - lastPoll > std::chrono::seconds(1)) {
+            if (now - lastPoll > pollInterval()) {
                 fscSendPoll();
                 lastPoll = now;
+                if (acquiring) {
+                    ++acquirePolls;
+                }
             }
             continue;
         }
         if (r1 < 0) {
             ++badReads;
+            ++link.badReads;
+            g_fscMetrics.badReads.add();
+            g_fscMetrics.connected.set(0);
 #if IBM
             DWORD e = GetLastError();
             logLine("FSC: read error (" + std::to_string(e) + "): " + win32ErrorMessage(e) + " (reconnecting)");
@@ -5927,6 +9090,7 @@ void fscLoop() {
             int e = errno;
             logLine("FSC: read error (" + std::to_string(e) + "): " + std::strerror(e) + " (reconnecting)");
 #endif
+            triggerFscRecorder(kFscRecReadError, "error " + std::to_string(e));
             {
                 std::lock_guard<std::mutex> lock(g_fscIoMutex);
                 intptr_t cur = g_fscFd.exchange(-1);
@@ -5934,11 +9098,15 @@ void fscLoop() {
                     closeFscPort(cur);
                 }
             }
+            FscTraceScope trace("reconnect_sleep");
             std::this_thread::sleep_for(std::chrono::seconds(1));
             continue;
         }
         auto now = std::chrono::steady_clock::now();
+        g_fscMetrics.lastRxNs.set(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count()));
         logFscRawBytes(RawLogDir::Rx, &b1, 1);
+        link.onByte(now);
         if (rawCaptureActive) {
             if (rawBytes >= 2048 || now > rawCaptureUntil) {
                 flushRaw(now, true);
@@ -5953,6 +9121,7 @@ void fscLoop() {
             }
         }
         if (!(b1 & 0x80)) {
+            link.onFramingError();
             continue;  // not a packet start
         }
         uint8_t b2 = 0;
@@ -5960,10 +9129,18 @@ void fscLoop() {
         if (currentHandle < 0) {
             continue;
         }
-        int r2 = readByteWithTimeout(currentHandle, b2, 100);
+        int r2 = 0;
+        {
+            FscTraceScope trace("read_second");
+            r2 = readByteWithTimeout(currentHandle, b2, 100);
+        }
         if (r2 <= 0) {
             if (r2 < 0) {
                 ++badReads;
+                ++link.badReads;
+                g_fscMetrics.badReads.add();
+            } else {
+                link.onSecondByteTimeout();
             }
             continue;
         }
@@ -5972,24 +9149,51 @@ void fscLoop() {
         lastRx = now;
 
         uint8_t cmd = static_cast<uint8_t>(b1 & 0x7E);
-        if ((cmd != 0x12) && (cmd != 0x16) && (cmd != 0x20) && (cmd != 0x22) && (cmd != 0x24) && (cmd != 0x26) &&
-            (cmd != 0x2A) && (cmd != 0x10) && (cmd != 0x2C)) {
-            if (g_prefs.fsc.debug && cmd < unknownLogged.size() && !unknownLogged[cmd]) {
+        g_fscMetrics.packets.add();
+        g_fscMetrics.cmdPackets[cmd >> 1].add();
+        g_fscMetrics.cmdLastData[cmd >> 1].set(b2);
+        link.onPacket(cmd, now);
+        const FscCommandDesc& desc = fscCommandDesc(cmd);
+        if (desc.kind != FscPacketKind::Unknown && !(desc.types & fscTypeBit(g_prefs.fsc.type))) {
+            if (!censusLogged[cmd >> 1]) {
+                logLine("FSC: packet " + hexByte(cmd) + " (" + desc.name + ") is not used with fsc.type=" +
+                        fscTypeToString(g_prefs.fsc.type) + "; check the configured hardware type");
+                censusLogged[cmd >> 1] = true;
+            }
+            g_fscMetrics.foreignPackets.add();
+        }
+        if (desc.kind == FscPacketKind::Unknown) {
+            if (!censusLogged[cmd >> 1]) {
                 logLine("FSC: unknown packet cmd=" + hexByte(cmd) + " b1=" + hexByte(b1) + " b2=" + hexByte(b2));
-                unknownLogged[cmd] = true;
+                censusLogged[cmd >> 1] = true;
             }
+            g_fscMetrics.unknownPackets.add();
+            ++link.unknown;
+            triggerFscRecorder(kFscRecUnknownCmd, "cmd=" + hexByte(cmd) + " b2=" + hexByte(b2));
         }
 
-        handleFscPacket(b1, b2);
+        {
+            FscTraceScope trace("packet", cmd);
+            handleFscPacket(b1, b2);
+        }
 
         auto pollNow = std::chrono::steady_clock::now();
-        if (pollNow - lastPoll > std::chrono::seconds(1)) {
+        if (acquiring && fscUpdateAcquisition(acquireStart, pollNow, acquirePolls)) {
+            acquiring = false;
+        }
+        if (pollNow - lastPoll > pollInterval()) {
             fscSendPoll();
             lastPoll = pollNow;
+            if (acquiring) {
+                ++acquirePolls;
+            }
         }
     }
     flushRaw(std::chrono::steady_clock::now(), true);
     maybeFlushRawLog(std::chrono::steady_clock::now(), true);
+    if (connectedBefore) {
+        link.report(std::chrono::steady_clock::now(), "stop");
+    }
     {
         std::lock_guard<std::mutex> lock(g_fscIoMutex);
         intptr_t cur = g_fscFd.exchange(-1);
@@ -5997,6 +9201,45 @@ void fscLoop() {
             closeFscPort(cur);
         }
     }
+    g_fscMetrics.connected.set(0);
+}
+
+static uint32_t fscRequiredChannels() {
+    static constexpr uint32_t kAxisBits[] = {
+        kFscSeenThrottle1, kFscSeenThrottle2, kFscSeenReverser1,
+        kFscSeenReverser2, kFscSeenSpeedbrake, kFscSeenFlaps,
+    };
+    static_assert(sizeof(kAxisBits) / sizeof(kAxisBits[0]) == static_cast<size_t>(FscAxisId::Count),
+                  "axis seen bits out of sync with FscAxisId");
+    uint32_t required = 0;
+    for (size_t i = 0; i < g_fscProfileRuntime.axes.size(); ++i) {
+        if (g_fscProfileRuntime.axes[i].defined) {
+            required |= kAxisBits[i];
+        }
+    }
+    for (size_t i = 0; i < g_fscProfileRuntime.switches.size(); ++i) {
+        if (!g_fscProfileRuntime.switches[i].defined) {
+            continue;
+        }
+        switch (static_cast<FscSwitchId>(i)) {
+            case FscSwitchId::PitchTrimWheel:
+                break;
+            case FscSwitchId::ElTrimGuard:
+            case FscSwitchId::ApTrimGuard:
+                required |= kFscSeenStabTrim;
+                break;
+            default:
+                required |= kFscSeenDigital;
+                break;
+        }
+    }
+    if (g_fscProfileRuntime.speedbrake.enabled) {
+        required |= kFscSeenSpeedbrake;
+    }
+    if (g_fscProfileRuntime.flaps.enabled) {
+        required |= kFscSeenFlaps;
+    }
+    return required;
 }
 
 void startFsc() {
@@ -6011,6 +9254,10 @@ void startFsc() {
         g_fscState = FscState{};
     }
     g_fscOut = FscOutputState{};
+    {
+        std::lock_guard<std::mutex> lock(g_fscOutputMutex);
+        g_fscOutputIntent = FscHwOutputs{};
+    }
     g_fscPrev = FscPrev{};
     for (auto& s : g_fscSwitchState) {
         s.known = false;
@@ -6018,6 +9265,7 @@ void startFsc() {
     }
     g_fscMotorThrottleActive.store(false);
     g_fscMotorSpeedbrakeActive.store(false);
+    g_fscRequiredChannels.store(fscRequiredChannels());
     g_fscRunning.store(true);
     g_fscThread = std::thread(fscLoop);
     g_fscActiveProfileId = g_fscProfileId;
@@ -6053,6 +9301,129 @@ static void updateFscLifecycle(const char* /*reason*/) {
     }
 }
 
+std::thread g_fscTraceExportThread;
+std::atomic<bool> g_fscTraceExportBusy{false};
+
+struct FscTraceSnapshot {
+    std::string threadName;
+    uint32_t tid = 0;
+    std::vector<FscTraceEvent> events;
+};
+
+static bool writeFscTraceJson(const std::string& path, const std::vector<FscTraceSnapshot>& threads) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+    char buf[256];
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    auto sep = [&]() {
+        if (!first) {
+            out << ",\n";
+        }
+        first = false;
+    };
+    sep();
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"" << PLUGIN_NAME << "\"}}";
+    for (const auto& t : threads) {
+        sep();
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t.tid << ",\"args\":{\"name\":\""
+            << t.threadName << "\"}}";
+        for (const auto& e : t.events) {
+            sep();
+            int n = 0;
+            if (e.phase == 'X') {
+                n = std::snprintf(buf, sizeof(buf), "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f",
+                                  e.name, t.tid, static_cast<double>(e.startNs) / 1000.0,
+                                  static_cast<double>(e.durNs) / 1000.0);
+            } else {
+                n = std::snprintf(buf, sizeof(buf), "{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%.3f",
+                                  e.name, t.tid, static_cast<double>(e.startNs) / 1000.0);
+            }
+            out.write(buf, std::max(0, std::min(n, static_cast<int>(sizeof(buf)) - 1)));
+            if (e.arg >= 0) {
+                out << ",\"args\":{\"v\":" << e.arg << "}";
+            }
+            out << "}";
+        }
+    }
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
+
+// Copies the per-thread rings (sim thread) and writes the JSON on a worker.
+static void exportFscTrace() {
+    if (!fscTraceEnabled()) {
+        logLine("FSC TRACE: tracing disabled (set fsc.trace=1)");
+        return;
+    }
+    if (g_fscTraceExportBusy.load()) {
+        logLine("FSC TRACE: export already running");
+        return;
+    }
+    std::vector<FscTraceSnapshot> threads;
+    size_t total = 0;
+    {
+        std::lock_guard<std::mutex> lock(g_fscTraceRegistryMutex);
+        for (const auto& buf : g_fscTraceBuffers) {
+            FscTraceSnapshot snap;
+            snap.threadName = buf->threadName;
+            snap.tid = buf->tid;
+            const uint64_t end = buf->written.load(std::memory_order_acquire);
+            const uint64_t begin = end > FscTraceBuffer::kEvents ? end - FscTraceBuffer::kEvents : 0;
+            snap.events.reserve(static_cast<size_t>(end - begin));
+            for (uint64_t i = begin; i < end; ++i) {
+                snap.events.push_back(buf->events[i & (FscTraceBuffer::kEvents - 1)]);
+            }
+            // The owner kept writing during the copy: drop slots it may have overwritten.
+            const uint64_t now = buf->written.load(std::memory_order_acquire);
+            if (now - begin > FscTraceBuffer::kEvents) {
+                const size_t stale = static_cast<size_t>(std::min<uint64_t>(now - begin - FscTraceBuffer::kEvents,
+                                                                            snap.events.size()));
+                snap.events.erase(snap.events.begin(), snap.events.begin() + static_cast<std::ptrdiff_t>(stale));
+            }
+            total += snap.events.size();
+            threads.push_back(std::move(snap));
+        }
+    }
+    const std::string prefix = dumpFilePrefix("trace");
+    const std::string path = prefix + dumpFileStamp() + ".json";
+    if (g_fscTraceExportThread.joinable()) {
+        g_fscTraceExportThread.join();
+    }
+    g_fscTraceExportBusy.store(true);
+    g_fscTraceExportThread = std::thread([threads = std::move(threads), path, prefix, total]() {
+        if (writeFscTraceJson(path, threads)) {
+            pruneDumpFiles(prefix, kFscTraceMaxExports);
+            logLine("FSC TRACE: wrote " + std::to_string(total) + " events to " + path);
+        } else {
+            logLine("FSC TRACE: failed to write " + path);
+        }
+        g_fscTraceExportBusy.store(false);
+    });
+}
+
+// Called with the I/O thread stopped, so the rings have no concurrent writer.
+static void configureFscTrace() {
+    const bool enable = g_prefs.fsc.trace;
+    if (enable && !fscTraceEnabled()) {
+        std::lock_guard<std::mutex> lock(g_fscTraceRegistryMutex);
+        for (auto& buf : g_fscTraceBuffers) {
+            buf->written.store(0);
+        }
+        g_fscTraceEpoch = std::chrono::steady_clock::now();
+    }
+    g_fscTraceEnabled.store(enable);
+}
+
+static void stopFscTrace() {
+    g_fscTraceEnabled.store(false);
+    if (g_fscTraceExportThread.joinable()) {
+        g_fscTraceExportThread.join();
+    }
+}
+
 static void reloadPrefs() {
     bool wasEnabled = g_pluginEnabled;
     stopFsc();
@@ -6064,6 +9435,9 @@ static void reloadPrefs() {
     g_prefs = loadPrefs();
     openLogFileFromPrefs();
     openRawLogFromPrefs();
+    openFscRecorderFromPrefs();
+    resetFscProfiler();
+    configureFscTrace();
     logLine("Prefs reloaded from " + getPrefsPath());
     logFscSettings();
     syncFscWindowFromPrefs();
@@ -6078,6 +9452,199 @@ static void reloadPrefs() {
     }
 }
 
+static int getFscMetricInt(void* refcon) {
+    return static_cast<int>(static_cast<const FscMetricCounter*>(refcon)->get());
+}
+
+static float getFscMetricFloat(void* refcon) {
+    return static_cast<const FscMetricGauge*>(refcon)->get();
+}
+
+static int getFscMetricStaleCount(void* /*refcon*/) {
+    uint64_t mask = g_fscMetrics.staleMask.get();
+    int n = 0;
+    for (; mask; mask &= mask - 1) {
+        ++n;
+    }
+    return n;
+}
+
+static float getFscMetricLastRxAgeMs(void* /*refcon*/) {
+    const uint64_t last = g_fscMetrics.lastRxNs.get();
+    if (last == 0) {
+        return -1.0f;
+    }
+    const auto now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+    return now > last ? static_cast<float>(now - last) / 1e6f : 0.0f;
+}
+
+static int getFscMetricCmdRates(void* /*refcon*/, float* values, int offset, int max) {
+    constexpr int kCount = static_cast<int>(kFscCommandSlots);
+    if (!values) {
+        return kCount;
+    }
+    int n = 0;
+    for (int i = offset; i < kCount && n < max; ++i, ++n) {
+        values[n] = g_fscMetrics.cmdPacketsPerSec[static_cast<size_t>(i)].get();
+    }
+    return n;
+}
+
+static int getFscMetricCmdPackets(void* /*refcon*/, int* values, int offset, int max) {
+    constexpr int kCount = static_cast<int>(kFscCommandSlots);
+    if (!values) {
+        return kCount;
+    }
+    int n = 0;
+    for (int i = offset; i < kCount && n < max; ++i, ++n) {
+        values[n] = static_cast<int>(g_fscMetrics.cmdPackets[static_cast<size_t>(i)].get());
+    }
+    return n;
+}
+
+// Protocol census: every command seen since plugin start, with its table entry,
+// rate and last data byte. Logged on FSCB738TQ/fsc_census (sim thread, reads
+// the metric atomics only).
+static void logFscCensus() {
+    const uint8_t typeBit = fscTypeBit(g_prefs.fsc.type);
+    logLine("FSC CENSUS: type=" + fscTypeToString(g_prefs.fsc.type) + " packets=" +
+            std::to_string(g_fscMetrics.packets.get()) + " unknown=" + std::to_string(g_fscMetrics.unknownPackets.get()) +
+            " foreign=" + std::to_string(g_fscMetrics.foreignPackets.get()));
+    for (size_t slot = 0; slot < kFscCommandSlots; ++slot) {
+        const uint64_t count = g_fscMetrics.cmdPackets[slot].get();
+        const FscCommandDesc& desc = kFscCommandTable[slot];
+        if (count == 0 && !(desc.types & typeBit)) {
+            continue;
+        }
+        const char* status = desc.kind == FscPacketKind::Unknown ? "unknown" : (desc.types & typeBit) ? "ok" : "foreign";
+        char rate[32];
+        std::snprintf(rate, sizeof(rate), "%.1f/s", static_cast<double>(g_fscMetrics.cmdPacketsPerSec[slot].get()));
+        std::string line = "FSC CENSUS: " + hexByte(static_cast<uint8_t>(slot << 1)) + " " + desc.name + " [" +
+                           status + "] n=" + std::to_string(count) + " rate=" + rate;
+        if (count > 0) {
+            line += " last=" + hexByte(static_cast<uint8_t>(g_fscMetrics.cmdLastData[slot].get()));
+        }
+        logLine(line);
+    }
+}
+
+static void registerFscMetricDatarefs() {
+    struct IntRef {
+        const char* name;
+        XPLMGetDatai_f get;
+        void* refcon;
+    };
+    struct FloatRef {
+        const char* name;
+        XPLMGetDataf_f get;
+        void* refcon;
+    };
+    const IntRef ints[] = {
+        {"packets", getFscMetricInt, &g_fscMetrics.packets},
+        {"bad_reads", getFscMetricInt, &g_fscMetrics.badReads},
+        {"reconnects", getFscMetricInt, &g_fscMetrics.reconnects},
+        {"unknown_packets", getFscMetricInt, &g_fscMetrics.unknownPackets},
+        {"framing_errors", getFscMetricInt, &g_fscMetrics.framingErrors},
+        {"second_byte_timeouts", getFscMetricInt, &g_fscMetrics.secondByteTimeouts},
+        {"rx_gaps", getFscMetricInt, &g_fscMetrics.rxGaps},
+        {"foreign_packets", getFscMetricInt, &g_fscMetrics.foreignPackets},
+        {"throttle_servo_stalls", getFscMetricInt, &g_fscMetrics.servoStalls},
+        {"throttle_servo_overrides", getFscMetricInt, &g_fscMetrics.servoOverrides},
+        {"output_deferred", getFscMetricInt, &g_fscMetrics.outputDeferred},
+        {"trim_indicator_writes", getFscMetricInt, &g_fscMetrics.trimIndicatorWrites},
+        {"motor_power_denied", getFscMetricInt, &g_fscMetrics.motorPowerDenied},
+        {"rx_bytes", getFscMetricInt, &g_fscMetrics.rxBytes},
+        {"tx_bytes", getFscMetricInt, &g_fscMetrics.txBytes},
+        {"connected", getFscMetricInt, &g_fscMetrics.connected},
+        {"stale_mask", getFscMetricInt, &g_fscMetrics.staleMask},
+        {"stale_channels", getFscMetricStaleCount, nullptr},
+        {"log_queue_depth", getFscMetricInt, &g_fscMetrics.logQueueDepth},
+        {"raw_log_spill_bytes", getFscMetricInt, &g_fscMetrics.rawLogSpillBytes},
+    };
+    const FloatRef floats[] = {
+        {"packets_per_sec", getFscMetricFloat, &g_fscMetrics.packetsPerSec},
+        {"frame_us", getFscMetricFloat, &g_fscMetrics.frameUs},
+        {"frame_max_us", getFscMetricFloat, &g_fscMetrics.frameMaxUs},
+        {"last_rx_age_ms", getFscMetricLastRxAgeMs, nullptr},
+    };
+    const std::string prefix = std::string(PLUGIN_COMMAND_PREFIX) + "/metrics/";
+    for (const auto& r : ints) {
+        g_fscMetricRefs.push_back(XPLMRegisterDataAccessor((prefix + r.name).c_str(), xplmType_Int, 0, r.get, nullptr,
+                                                           nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                                           nullptr, nullptr, nullptr, nullptr, r.refcon, nullptr));
+    }
+    for (const auto& r : floats) {
+        g_fscMetricRefs.push_back(XPLMRegisterDataAccessor((prefix + r.name).c_str(), xplmType_Float, 0, nullptr,
+                                                           nullptr, r.get, nullptr, nullptr, nullptr, nullptr,
+                                                           nullptr, nullptr, nullptr, nullptr, nullptr, r.refcon,
+                                                           nullptr));
+    }
+    g_fscMetricRefs.push_back(XPLMRegisterDataAccessor((prefix + "cmd_packets_per_sec").c_str(), xplmType_FloatArray,
+                                                       0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                                       nullptr, nullptr, getFscMetricCmdRates, nullptr, nullptr,
+                                                       nullptr, nullptr, nullptr));
+    g_fscMetricRefs.push_back(XPLMRegisterDataAccessor((prefix + "cmd_packets").c_str(), xplmType_IntArray, 0,
+                                                       nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                                       getFscMetricCmdPackets, nullptr, nullptr, nullptr, nullptr,
+                                                       nullptr, nullptr, nullptr));
+}
+
+static void unregisterFscMetricDatarefs() {
+    for (XPLMDataRef ref : g_fscMetricRefs) {
+        if (ref) {
+            XPLMUnregisterDataAccessor(ref);
+        }
+    }
+    g_fscMetricRefs.clear();
+}
+
+int censusCommandHandler(XPLMCommandRef cmd, XPLMCommandPhase phase, void* /*refcon*/) {
+    if (phase == xplm_CommandBegin && cmd == g_cmdCensus) {
+        logFscCensus();
+    }
+    return 1;
+}
+
+int linkReportCommandHandler(XPLMCommandRef cmd, XPLMCommandPhase phase, void* /*refcon*/) {
+    if (phase == xplm_CommandBegin && cmd == g_cmdLinkReport) {
+        if (g_fscRunning.load()) {
+            g_fscLinkReportRequested.store(true);  // logged by the I/O thread
+        } else {
+            logLine("FSC LINK: not running");
+        }
+    }
+    return 1;
+}
+
+int traceExportCommandHandler(XPLMCommandRef cmd, XPLMCommandPhase phase, void* /*refcon*/) {
+    if (phase == xplm_CommandBegin && cmd == g_cmdTraceExport) {
+        exportFscTrace();
+    }
+    return 1;
+}
+
+int profilerDumpCommandHandler(XPLMCommandRef cmd, XPLMCommandPhase phase, void* /*refcon*/) {
+    if (phase == xplm_CommandBegin && cmd == g_cmdProfilerDump) {
+        dumpFscProfiler();
+    }
+    return 1;
+}
+
+int recorderDumpCommandHandler(XPLMCommandRef cmd, XPLMCommandPhase phase, void* /*refcon*/) {
+    if (phase != xplm_CommandBegin) {
+        return 1;
+    }
+    if (cmd == g_cmdRecorderDump) {
+        if (!g_fscRecorderActive.load()) {
+            logLine("FSC REC: recorder disabled (fsc.recorder=0)");
+        } else {
+            triggerFscRecorder(kFscRecCommand, "");
+        }
+    }
+    return 1;
+}
+
 int reloadPrefsCommandHandler(XPLMCommandRef cmd, XPLMCommandPhase phase, void* /*refcon*/) {
     if (phase != xplm_CommandBegin) {
         return 1;
@@ -6089,10 +9656,14 @@ int reloadPrefsCommandHandler(XPLMCommandRef cmd, XPLMCommandPhase phase, void*
 }
 
 static void fscPluginStartCommon(bool registerFlightLoop) {
+    startLogWriter();
     g_prefs = loadPrefs();
     logLine("Prefs loaded from " + getPrefsPath());
     openLogFileFromPrefs();
     openRawLogFromPrefs();
+    openFscRecorderFromPrefs();
+    resetFscProfiler();
+    configureFscTrace();
     logLine(std::string("Plugin version ") + kPluginVersion);
     logFscSettings();
 
@@ -6107,15 +9678,31 @@ static void fscPluginStartCommon(bool registerFlightLoop) {
     std::string cmdCancel = cmdName("fsc_calib_cancel");
     std::string cmdReload = cmdName("reload_prefs");
     std::string cmdReloadDesc = "Reload " + std::string(PLUGIN_PREFS_FILE) + " and reinitialize connections";
+    std::string cmdRecorderDump = cmdName("fsc_recorder_dump");
+    std::string cmdProfilerDump = cmdName("fsc_profiler_dump");
+    std::string cmdTraceExport = cmdName("fsc_trace_export");
+    std::string cmdLinkReport = cmdName("fsc_link_report");
+    std::string cmdCensus = cmdName("fsc_census");
     g_cmdFscCalibStart = XPLMCreateCommand(cmdStart.c_str(), "Start FSC throttle quadrant calibration");
     g_cmdFscCalibNext = XPLMCreateCommand(cmdNext.c_str(), "Next step in FSC calibration");
     g_cmdFscCalibCancel = XPLMCreateCommand(cmdCancel.c_str(), "Cancel FSC calibration");
     g_cmdReloadPrefs = XPLMCreateCommand(cmdReload.c_str(), cmdReloadDesc.c_str());
+    g_cmdRecorderDump = XPLMCreateCommand(cmdRecorderDump.c_str(), "Dump the FSC flight recorder window to disk");
+    g_cmdProfilerDump = XPLMCreateCommand(cmdProfilerDump.c_str(), "Log FSC flight-loop stage timings (p50/p99/max)");
+    g_cmdTraceExport = XPLMCreateCommand(cmdTraceExport.c_str(), "Export FSC thread activity as Chrome trace JSON");
+    g_cmdLinkReport = XPLMCreateCommand(cmdLinkReport.c_str(), "Log FSC serial link quality statistics");
+    g_cmdCensus = XPLMCreateCommand(cmdCensus.c_str(), "Log the FSC packet command census");
     XPLMRegisterCommandHandler(g_cmdFscCalibStart, fscCalibCommandHandler, 1, nullptr);
     XPLMRegisterCommandHandler(g_cmdFscCalibNext, fscCalibCommandHandler, 1, nullptr);
     XPLMRegisterCommandHandler(g_cmdFscCalibCancel, fscCalibCommandHandler, 1, nullptr);
     XPLMRegisterCommandHandler(g_cmdReloadPrefs, reloadPrefsCommandHandler, 1, nullptr);
+    XPLMRegisterCommandHandler(g_cmdRecorderDump, recorderDumpCommandHandler, 1, nullptr);
+    XPLMRegisterCommandHandler(g_cmdProfilerDump, profilerDumpCommandHandler, 1, nullptr);
+    XPLMRegisterCommandHandler(g_cmdTraceExport, traceExportCommandHandler, 1, nullptr);
+    XPLMRegisterCommandHandler(g_cmdLinkReport, linkReportCommandHandler, 1, nullptr);
+    XPLMRegisterCommandHandler(g_cmdCensus, censusCommandHandler, 1, nullptr);
     createPluginMenu();
+    registerFscMetricDatarefs();
 
     if (registerFlightLoop) {
         XPLMRegisterFlightLoopCallback(flightLoopCallback, -1.0f, nullptr);
@@ -6147,13 +9734,42 @@ static void fscPluginStopCommon(bool unregisterFlightLoop) {
         XPLMUnregisterCommandHandler(g_cmdReloadPrefs, reloadPrefsCommandHandler, 1, nullptr);
         g_cmdReloadPrefs = nullptr;
     }
+    if (g_cmdRecorderDump) {
+        XPLMUnregisterCommandHandler(g_cmdRecorderDump, recorderDumpCommandHandler, 1, nullptr);
+        g_cmdRecorderDump = nullptr;
+    }
+    if (g_cmdProfilerDump) {
+        XPLMUnregisterCommandHandler(g_cmdProfilerDump, profilerDumpCommandHandler, 1, nullptr);
+        g_cmdProfilerDump = nullptr;
+    }
+    if (g_cmdTraceExport) {
+        XPLMUnregisterCommandHandler(g_cmdTraceExport, traceExportCommandHandler, 1, nullptr);
+        g_cmdTraceExport = nullptr;
+    }
+    if (g_cmdLinkReport) {
+        XPLMUnregisterCommandHandler(g_cmdLinkReport, linkReportCommandHandler, 1, nullptr);
+        g_cmdLinkReport = nullptr;
+    }
+    if (g_cmdCensus) {
+        XPLMUnregisterCommandHandler(g_cmdCensus, censusCommandHandler, 1, nullptr);
+        g_cmdCensus = nullptr;
+    }
     if (unregisterFlightLoop) {
         XPLMUnregisterFlightLoopCallback(flightLoopCallback, nullptr);
     }
-    if (g_fileLog.is_open()) {
-        g_fileLog.close();
-    }
+    unregisterFscMetricDatarefs();
+    stopFscTrace();
+    stopFscRecorder();
     closeRawLog();
+    logLine("Stopped (log lines written=" + std::to_string(g_logWritten.load()) +
+            ", dropped=" + std::to_string(g_logDropped.load()) + ")");
+    stopLogWriter();
+    {
+        std::lock_guard<std::mutex> lock(g_logMutex);
+        if (g_fileLog.is_open()) {
+            g_fileLog.close();
+        }
+    }
 }
 
 static void fscPluginDisableCommon() {
@@ -6170,6 +9786,13 @@ static int fscPluginEnableCommon() {
 }
 
 static void fscPluginReceiveMessageCommon(int inMessage) {
+    if (inMessage == XPLM_MSG_AIRPORT_LOADED && isFscBoundAircraftCurrent()) {
+        // Reposition with the same aircraft: keep bindings and live I/O, only
+        // re-apply latching switches (the sim may have reset them).
+        g_fscResyncPending.store(true);
+        logLine("FSC: airport loaded with unchanged aircraft, keeping profile '" + g_fscProfileId + "'");
+        return;
+    }
     if (inMessage == XPLM_MSG_AIRPORT_LOADED || inMessage == XPLM_MSG_PLANE_LOADED) {
         refreshFscProfile(true);
         updateFscLifecycle("aircraft load");
@@ -0,0 +1,119 @@
+#pragma once
+
+// FSC throttle quadrant serial protocol, shared by the plugin and the offline
+// tools. No XPLM dependency.
+//
+// RX packets are two bytes: b1 = 0x80 | command (bits 1..6) | data MSB (bit 0),
+// b2 = data bits 0..6. TX frames are three bytes (0x87 outputs, 0x8B motor
+// position, 0x93 motor power / poll).
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace fsc_proto {
+
+// Input channels reported by the quadrant (index = bit in FscState::seen).
+enum class Channel { Digital, StabTrim, Reverser1, Reverser2, Throttle1, Throttle2, Flaps, Speedbrake, Count };
+constexpr size_t kChannelCount = static_cast<size_t>(Channel::Count);
+constexpr const char* kChannelNames[kChannelCount] = {
+    "digital", "stab_trim", "reverser1", "reverser2", "throttle1", "throttle2", "flaps", "speedbrake",
+};
+
+// Hardware variants as a bit mask (same order as Prefs::FscType).
+constexpr uint8_t kTypeSemiPro = 0x01;
+constexpr uint8_t kTypePro = 0x02;
+constexpr uint8_t kTypeMotorized = 0x04;
+constexpr uint8_t kTypesAll = kTypeSemiPro | kTypePro | kTypeMotorized;
+
+enum class PacketKind : uint8_t { Unknown, Channel, FlapsTrim };
+
+struct CommandDesc {
+    const char* name = "unknown";
+    PacketKind kind = PacketKind::Unknown;
+    Channel channel = Channel::Count;
+    uint8_t types = 0;  // kType* bits of the hardware variants that send it
+};
+
+// Indexed by (b1 & 0x7E) >> 1; bit 0 of b1 is the data MSB.
+constexpr size_t kCommandSlots = 64;
+
+constexpr std::array<CommandDesc, kCommandSlots> makeCommandTable() {
+    std::array<CommandDesc, kCommandSlots> t{};
+    auto set = [&t](uint8_t cmd, const char* name, PacketKind kind, Channel ch, uint8_t types) {
+        t[cmd >> 1] = CommandDesc{name, kind, ch, types};
+    };
+    set(0x10, "flaps_trim", PacketKind::FlapsTrim, Channel::Flaps, kTypePro | kTypeMotorized);
+    set(0x12, "digital", PacketKind::Channel, Channel::Digital, kTypesAll);  // active low
+    set(0x16, "stab_trim", PacketKind::Channel, Channel::StabTrim, kTypesAll);
+    set(0x20, "reverser1", PacketKind::Channel, Channel::Reverser1, kTypesAll);
+    set(0x22, "reverser2", PacketKind::Channel, Channel::Reverser2, kTypesAll);
+    set(0x24, "throttle1", PacketKind::Channel, Channel::Throttle1, kTypesAll);
+    set(0x26, "throttle2", PacketKind::Channel, Channel::Throttle2, kTypesAll);
+    set(0x2A, "flaps", PacketKind::Channel, Channel::Flaps, kTypeSemiPro);
+    set(0x2C, "speedbrake", PacketKind::Channel, Channel::Speedbrake, kTypesAll);
+    return t;
+}
+constexpr auto kCommandTable = makeCommandTable();
+static_assert(kCommandTable[0x24 >> 1].channel == Channel::Throttle1, "command table layout");
+
+constexpr const CommandDesc& commandDesc(uint8_t cmd) {
+    return kCommandTable[(cmd & 0x7E) >> 1];
+}
+
+// 8-bit channel value of a packet (data MSB from b1, low bits from b2).
+constexpr int packetValue(uint8_t b1, uint8_t b2) {
+    return ((b1 & 0x01) << 7) | (b2 & 0x7F);
+}
+
+// Flap lever position from the low nibble of a 0x10 packet, -1 between detents.
+constexpr int decodeFlapCode(uint8_t y) {
+    switch (y & 0x0F) {
+        case 0x8: return 0;   // 1000
+        case 0xC: return 1;   // 1100
+        case 0xE: return 2;   // 1110
+        case 0xF: return 5;   // 1111
+        case 0x7: return 10;  // 0111
+        case 0x3: return 15;  // 0011
+        case 0x2: return 25;  // 0010
+        case 0x1: return 30;  // 0001
+        case 0x9: return 40;  // 1001
+        default: return -1;
+    }
+}
+
+// Trim wheel quadrature bits (A<<1 | B) of a 0x10 packet.
+constexpr int trimWheelBits(uint8_t y) {
+    return (((y >> 4) & 0x01) << 1) | ((y >> 5) & 0x01);
+}
+
+// Gray code quadrature step between two trimWheelBits() readings.
+constexpr int trimWheelStep(int lastAB, int ab) {
+    switch ((lastAB << 2) | ab) {
+        case 0b0001:
+        case 0b0111:
+        case 0b1110:
+        case 0b1000:
+            return +1;
+        case 0b0010:
+        case 0b1011:
+        case 0b1101:
+        case 0b0100:
+            return -1;
+        default:
+            return 0;
+    }
+}
+
+// Motor targets of 0x8B frames: second byte = base | value MSB, third = low 7 bits.
+constexpr const char* motorTargetName(uint8_t base) {
+    switch (base & 0x70) {
+        case 0x00: return "throttle1";
+        case 0x10: return "throttle2";
+        case 0x20: return "speedbrake";
+        case 0x30: return "trim_indicator";
+        default: return "motor?";
+    }
+}
+
+}  // namespace fsc_proto
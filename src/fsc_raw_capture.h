@@ -0,0 +1,113 @@
+#pragma once
+
+// Raw serial capture formats shared by the plugin and the offline tools.
+// No XPLM dependency.
+//
+// Binary capture (fsc.raw_log_format=binary), little-endian:
+//   header (16 bytes): magic "FSCRAW01", uint32 record size, uint32 reserved
+//   records (16 bytes): uint64 ns since capture start, uint8 direction (1=RX, 2=TX),
+//                       uint8 byte count (1..6), uint8 bytes[6]
+// Timestamps are relative to the moment the capture was opened and keep
+// counting across rotated segments.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace fsc_raw {
+
+constexpr char kMagic[8] = {'F', 'S', 'C', 'R', 'A', 'W', '0', '1'};
+constexpr uint8_t kDirRx = 1;
+constexpr uint8_t kDirTx = 2;
+constexpr size_t kRecordPayload = 6;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t recordSize;
+    uint32_t reserved;
+};
+
+struct Record {
+    uint64_t timeNs;
+    uint8_t dir;
+    uint8_t count;
+    uint8_t bytes[kRecordPayload];
+};
+
+static_assert(sizeof(FileHeader) == 16, "raw capture header must be 16 bytes");
+static_assert(sizeof(Record) == 16, "raw capture record must be 16 bytes");
+
+inline FileHeader makeHeader() {
+    FileHeader h{};
+    std::memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.recordSize = static_cast<uint32_t>(sizeof(Record));
+    return h;
+}
+
+inline bool checkHeader(const FileHeader& h) {
+    return std::memcmp(h.magic, kMagic, sizeof(kMagic)) == 0 && h.recordSize == sizeof(Record);
+}
+
+// Appends "0xAB" (upper case), the byte notation of the text raw log.
+inline void appendHexByte(std::string& out, uint8_t v) {
+    static const char kDigits[] = "0123456789ABCDEF";
+    out.push_back('0');
+    out.push_back('x');
+    out.push_back(kDigits[v >> 4]);
+    out.push_back(kDigits[v & 0x0F]);
+}
+
+// Groups bytes into text raw-log lines exactly like the plugin's text mode:
+// one direction per line, at most 32 bytes, a new line after 200 ms.
+// Output lines: "<seconds> RX: 0x80 0x12 ..." with millisecond precision.
+class TextLineBuilder {
+public:
+    static constexpr int kLineBytesMax = 32;
+    static constexpr uint64_t kLineMaxAgeNs = 200000000ull;
+
+    // Adds one byte; returns true and fills |line| when a line was completed.
+    bool add(uint64_t timeNs, uint8_t dir, uint8_t value, std::string& line) {
+        bool emitted = false;
+        if (bytes_ > 0 && (dir != dir_ || timeNs - start_ > kLineMaxAgeNs)) {
+            emitted = finish(line);
+        }
+        if (bytes_ == 0) {
+            dir_ = dir;
+            start_ = timeNs;
+        } else {
+            text_.push_back(' ');
+        }
+        appendHexByte(text_, value);
+        if (++bytes_ >= kLineBytesMax) {
+            // Cannot coincide with the flush above (that leaves a single byte).
+            return finish(line);
+        }
+        return emitted;
+    }
+
+    // Completes the pending line, if any.
+    bool finish(std::string& line) {
+        if (bytes_ == 0) {
+            return false;
+        }
+        char stamp[48];
+        std::snprintf(stamp, sizeof(stamp), "%.3f %s: ", static_cast<double>(start_) / 1e9,
+                      dir_ == kDirTx ? "TX" : "RX");
+        line = stamp;
+        line += text_;
+        line.push_back('\n');
+        text_.clear();
+        bytes_ = 0;
+        return true;
+    }
+
+private:
+    std::string text_;
+    int bytes_ = 0;
+    uint8_t dir_ = kDirRx;
+    uint64_t start_ = 0;
+};
+
+}  // namespace fsc_raw
@@ -0,0 +1,70 @@
+// Converts a binary FSC raw capture (fsc.raw_log_format=binary) into the text
+// format of the continuous RAW log (fsc.raw_log_format=text).
+//
+// Usage: fsc_rawconv <capture.bin> [output.log]
+// Without an output path the text is written to stdout.
+
+#include "fsc_raw_capture.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        std::fprintf(stderr, "usage: %s <capture.bin> [output.log]\n", argv[0]);
+        return 2;
+    }
+    std::FILE* in = std::fopen(argv[1], "rb");
+    if (!in) {
+        std::fprintf(stderr, "fsc_rawconv: cannot open %s\n", argv[1]);
+        return 1;
+    }
+    std::FILE* out = stdout;
+    if (argc == 3) {
+        out = std::fopen(argv[2], "w");
+        if (!out) {
+            std::fprintf(stderr, "fsc_rawconv: cannot create %s\n", argv[2]);
+            std::fclose(in);
+            return 1;
+        }
+    }
+
+    fsc_raw::FileHeader header{};
+    if (std::fread(&header, sizeof(header), 1, in) != 1 || !fsc_raw::checkHeader(header)) {
+        std::fprintf(stderr, "fsc_rawconv: %s is not a binary FSC raw capture\n", argv[1]);
+        std::fclose(in);
+        if (out != stdout) {
+            std::fclose(out);
+        }
+        return 1;
+    }
+
+    std::vector<fsc_raw::Record> records(4096);
+    fsc_raw::TextLineBuilder builder;
+    std::string line;
+    size_t total = 0;
+    size_t n = 0;
+    while ((n = std::fread(records.data(), sizeof(fsc_raw::Record), records.size(), in)) > 0) {
+        for (size_t i = 0; i < n; ++i) {
+            const auto& rec = records[i];
+            const size_t count = rec.count <= fsc_raw::kRecordPayload ? rec.count : fsc_raw::kRecordPayload;
+            for (size_t b = 0; b < count; ++b) {
+                if (builder.add(rec.timeNs, rec.dir, rec.bytes[b], line)) {
+                    std::fputs(line.c_str(), out);
+                }
+            }
+        }
+        total += n;
+    }
+    if (builder.finish(line)) {
+        std::fputs(line.c_str(), out);
+    }
+
+    std::fclose(in);
+    if (out != stdout) {
+        std::fclose(out);
+    }
+    std::fprintf(stderr, "fsc_rawconv: %zu records\n", total);
+    return 0;
+}
@@ -0,0 +1,1112 @@
+// Offline analysis of FSC raw serial logs (fsc.raw_log=1, text or binary).
+//
+// Usage: fsc_rawstat [options] <raw log>...
+//   -j N            worker threads (default: all cores)
+//   --type T        SEMIPRO, PRO or MOTORIZED (default: inferred from the packets)
+//   --gap-ms N      RX silence counted as a gap (default 1500, as fsc.link_gap_ms)
+//   --timeline      print per-channel min..max over time (at most 64 rows per capture)
+//   --no-segments   do not pick up rotated .3/.2/.1 segments
+//   --filter SPEC   replay the axis channels through a filter chain and report
+//                   noise against added latency (repeatable; see below)
+//
+// Each argument is one capture; its rotated segments (<file>.3 .. <file>.1)
+// are read first, oldest first, so a rotated capture is analyzed as one
+// stream. Captures are analyzed in parallel and reported in argument order.
+// Files are streamed with fixed-size state, so memory does not grow with the
+// capture size. Decoding uses fsc_protocol.h, the tables the plugin uses.
+//
+// Timing: binary captures carry a timestamp per record; text logs only per
+// line (a line collects up to 200 ms of bytes), so intervals and jitter from
+// text logs are coarse.
+//
+// Filter bench: SPEC is a chain in the compact fsc_filter.h form, e.g.
+// "median:5,ema:30" or "one_euro:1:0.02". Every axis channel is run through
+// each chain and, as the baseline, unfiltered. As in the plugin the chains
+// are also advanced every 10 ms (the default fsc.output_period_ms) between
+// samples. Noise is the step-to-step change (RMS) and the peak-to-peak swing
+// of the output while the raw lever rests; latency is how much later the
+// output than the raw value crosses the midpoint of each move between two
+// rests, and settle is how long after the raw lever came to rest the output
+// stays within 1.5 counts of the rest level. Use binary captures: with text
+// logs many samples share a line timestamp and the latency is meaningless.
+
+#include "fsc_filter.h"
+#include "fsc_histogram.h"
+#include "fsc_protocol.h"
+#include "fsc_raw_capture.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+    unsigned jobs = 0;
+    uint8_t types = 0;  // fsc_proto::kType* bit, 0 = infer
+    uint64_t gapNs = 1500ull * 1000000ull;
+    bool timeline = false;
+    bool segments = true;
+    std::vector<fsc_filter::ChainConfig> filters;  // --filter, in argument order
+};
+
+// Per-channel min..max in time buckets. When the buckets run out their width
+// doubles and neighbours merge, so any capture length fits in kRows rows.
+class Timeline {
+public:
+    static constexpr size_t kRows = 64;
+
+    void add(uint64_t timeNs, size_t ch, int value) {
+        while (timeNs >= widthNs_ * kRows) {
+            merge();
+        }
+        Cell& c = rows_[static_cast<size_t>(timeNs / widthNs_)][ch];
+        if (c.count++ == 0) {
+            c.min = c.max = value;
+        } else {
+            c.min = std::min(c.min, value);
+            c.max = std::max(c.max, value);
+        }
+    }
+
+    void print(std::string& out, uint64_t endNs) const {
+        char buf[96];
+        out += "  timeline (min..max per row):\n    time_s";
+        for (const char* name : fsc_proto::kChannelNames) {
+            std::snprintf(buf, sizeof(buf), " %11s", name);
+            out += buf;
+        }
+        out += '\n';
+        for (size_t r = 0; r < kRows && r * widthNs_ <= endNs; ++r) {
+            std::snprintf(buf, sizeof(buf), "    %6.1f", static_cast<double>(r * widthNs_) / 1e9);
+            out += buf;
+            for (const Cell& c : rows_[r]) {
+                if (c.count == 0) {
+                    std::snprintf(buf, sizeof(buf), " %11s", "-");
+                } else {
+                    std::snprintf(buf, sizeof(buf), " %5d..%-4d", c.min, c.max);
+                }
+                out += buf;
+            }
+            out += '\n';
+        }
+    }
+
+private:
+    struct Cell {
+        int min = 0;
+        int max = 0;
+        uint32_t count = 0;
+    };
+    using Row = std::array<Cell, fsc_proto::kChannelCount>;
+
+    void merge() {
+        for (size_t r = 0; r < kRows; ++r) {
+            Row merged{};
+            if (2 * r < kRows) {
+                for (size_t half = 0; half < 2; ++half) {
+                    const Row& src = rows_[2 * r + half];
+                    for (size_t ch = 0; ch < merged.size(); ++ch) {
+                        const Cell& c = src[ch];
+                        if (c.count == 0) {
+                            continue;
+                        }
+                        Cell& m = merged[ch];
+                        m.min = m.count ? std::min(m.min, c.min) : c.min;
+                        m.max = m.count ? std::max(m.max, c.max) : c.max;
+                        m.count += c.count;
+                    }
+                }
+            }
+            rows_[r] = merged;
+        }
+        widthNs_ *= 2;
+    }
+
+    std::array<Row, kRows> rows_{};
+    uint64_t widthNs_ = 1000000000ull;  // 1 s to start with
+};
+
+// Filter bench state of the axis channels (see the header comment).
+class FilterBench {
+public:
+    explicit FilterBench(const std::vector<fsc_filter::ChainConfig>& filters) {
+        for (Axis& a : axes_) {
+            a.chains.resize(filters.size() + 1);
+            for (size_t k = 0; k < filters.size(); ++k) {
+                a.chains[k + 1].chain.configure(filters[k]);
+            }
+            a.outputs.resize(a.chains.size());
+        }
+    }
+
+    static bool benched(size_t ch) {
+        return ch >= static_cast<size_t>(fsc_proto::Channel::Reverser1) && ch < fsc_proto::kChannelCount;
+    }
+
+    // New session: the plugin restarts its chains on (re)connect as well.
+    void restart() {
+        for (Axis& a : axes_) {
+            for (ChainStats& c : a.chains) {
+                c.chain.reset();
+            }
+            a.have = false;
+            a.sampleDtNs = 0;
+            a.phase = Phase::Unknown;
+            a.move.clear();
+            a.moveOut.clear();
+        }
+    }
+
+    void sample(uint64_t t, size_t ch, int value) {
+        for (Axis& a : axes_) {
+            tickTo(a, t);
+        }
+        Axis& a = axes_[ch];
+        const float dt = a.have ? static_cast<float>(t - a.tickNs) / 1e9f : 0.0f;
+        const float x = static_cast<float>(value);
+        for (size_t k = 0; k < a.chains.size(); ++k) {
+            a.outputs[k] = a.chains[k].chain.process(x, dt);
+        }
+        a.sampleDtNs = a.have ? t - a.lastNs : 0;
+        a.have = true;
+        a.lastNs = t;
+        a.tickNs = t;
+        a.value = value;
+        step(a, t);
+    }
+
+    void report(std::string& out, bool coarseTime) const;
+
+private:
+    static constexpr int kRestSpan = 3;                          // counts
+    static constexpr uint64_t kRestWindowNs = 250ull * 1000000;  // a move ends after this long at rest...
+    static constexpr float kSettleBand = 1.5f;                   // ...and every output within this of the rest level
+    static constexpr uint64_t kMaxSettleNs = 2000ull * 1000000;  // or this long at rest
+    static constexpr uint64_t kTickNs = 10ull * 1000000;         // plugin output tick
+    static constexpr int kMinMove = 16;                          // counts between the two rests
+    static constexpr size_t kMaxMoveSamples = 8192;
+
+    enum class Phase { Unknown, Rest, Move };
+
+    struct ChainStats {
+        fsc_filter::Chain chain;
+        float restLast = 0.0f;
+        float restMin = 0.0f;
+        float restMax = 0.0f;
+        double sumSq = 0.0;
+        uint64_t steps = 0;
+        double swingSum = 0.0;
+        FscLatencyHistogram lag;
+        uint64_t missed = 0;
+        FscLatencyHistogram settle;
+        uint64_t unsettled = 0;  // not within kSettleBand after kMaxSettleNs
+    };
+    struct MoveSample {
+        uint64_t t;
+        float raw;
+    };
+    struct Axis {
+        std::vector<ChainStats> chains;  // [0] = unfiltered
+        std::vector<float> outputs;
+        bool have = false;
+        uint64_t lastNs = 0;
+        uint64_t sampleDtNs = 0;  // between the last two samples
+        uint64_t tickNs = 0;      // last sample or tick
+        int value = 0;
+        int restMin = 0;
+        int restMax = 0;
+        uint64_t restCount = 0;
+        uint64_t restSinceNs = 0;
+        Phase phase = Phase::Unknown;
+        uint64_t restStartNs = 0;
+        uint64_t lastRestNs = 0;
+        uint64_t restNs = 0;
+        uint64_t rests = 0;
+        float moveFrom = 0.0f;
+        std::vector<MoveSample> move;
+        std::vector<float> moveOut;  // outputs per move sample, chains.size() each
+        bool moveTooLong = false;
+        uint64_t moves = 0;
+        uint64_t skippedMoves = 0;
+    };
+
+    // Advances the chains of an axis in kTickNs steps up to |t|, as
+    // advanceFscAxisFilters() does between samples.
+    void tickTo(Axis& a, uint64_t t) {
+        if (!a.have) {
+            return;
+        }
+        while (t >= a.tickNs + kTickNs) {
+            a.tickNs += kTickNs;
+            const bool idle = a.tickNs - a.lastNs > 2 * a.sampleDtNs + 5ull * 1000000;
+            for (size_t k = 0; k < a.chains.size(); ++k) {
+                a.outputs[k] = a.chains[k].chain.advance(static_cast<float>(kTickNs) / 1e9f, idle);
+            }
+            step(a, a.tickNs);
+        }
+    }
+
+    // Rest/move tracking of one output step (a sample or a tick).
+    void step(Axis& a, uint64_t t) {
+        const int value = a.value;
+        const float x = static_cast<float>(value);
+        // Rest candidate: the raw value stayed within kRestSpan counts since restSince.
+        const bool stillAtRest = a.restCount > 0 && std::max(a.restMax, value) - std::min(a.restMin, value) <= kRestSpan;
+        if (stillAtRest) {
+            a.restMin = std::min(a.restMin, value);
+            a.restMax = std::max(a.restMax, value);
+            ++a.restCount;
+        } else {
+            if (a.phase == Phase::Rest) {
+                endRest(a);
+                a.phase = Phase::Move;
+                a.moveFrom = restLevel(a);
+                a.move.clear();
+                a.moveOut.clear();
+            }
+            a.restMin = a.restMax = value;
+            a.restCount = 1;
+            a.restSinceNs = t;
+        }
+        const bool rested = t - a.restSinceNs >= kRestWindowNs;
+
+        if (a.phase == Phase::Rest) {
+            restSample(a, t);
+        } else if (a.phase == Phase::Move) {
+            if (a.move.size() < kMaxMoveSamples) {
+                a.move.push_back(MoveSample{t, x});
+                a.moveOut.insert(a.moveOut.end(), a.outputs.begin(), a.outputs.end());
+            } else {
+                a.moveTooLong = true;
+            }
+            bool settled = true;
+            for (float y : a.outputs) {
+                settled = settled && std::fabs(y - restLevel(a)) <= kSettleBand;
+            }
+            if (rested && (settled || t - a.restSinceNs >= kMaxSettleNs)) {
+                endMove(a);
+                startRest(a, t);
+            }
+        } else if (rested) {
+            startRest(a, t);
+        }
+    }
+
+    static float restLevel(const Axis& a) { return 0.5f * static_cast<float>(a.restMin + a.restMax); }
+
+    void startRest(Axis& a, uint64_t t) {
+        a.phase = Phase::Rest;
+        a.restStartNs = t;
+        ++a.rests;
+        for (size_t k = 0; k < a.chains.size(); ++k) {
+            ChainStats& c = a.chains[k];
+            c.restLast = c.restMin = c.restMax = a.outputs[k];
+        }
+    }
+
+    void restSample(Axis& a, uint64_t t) {
+        a.lastRestNs = t;
+        for (size_t k = 0; k < a.chains.size(); ++k) {
+            ChainStats& c = a.chains[k];
+            const float y = a.outputs[k];
+            const double delta = static_cast<double>(y - c.restLast);
+            c.sumSq += delta * delta;
+            ++c.steps;
+            c.restLast = y;
+            c.restMin = std::min(c.restMin, y);
+            c.restMax = std::max(c.restMax, y);
+        }
+    }
+
+    void endRest(Axis& a) {
+        a.restNs += a.lastRestNs > a.restStartNs ? a.lastRestNs - a.restStartNs : 0;
+        for (ChainStats& c : a.chains) {
+            c.swingSum += static_cast<double>(c.restMax - c.restMin);
+        }
+    }
+
+    void endMove(Axis& a) {
+        const float to = restLevel(a);
+        const bool tooLong = a.moveTooLong;
+        a.moveTooLong = false;
+        if (std::fabs(to - a.moveFrom) < static_cast<float>(kMinMove)) {
+            return;
+        }
+        if (tooLong) {
+            ++a.skippedMoves;
+            return;
+        }
+        const float mid = 0.5f * (a.moveFrom + to);
+        const bool up = to > a.moveFrom;
+        auto crossed = [&](float v) { return up ? v >= mid : v <= mid; };
+        size_t rawAt = a.move.size();
+        for (size_t i = 0; i < a.move.size(); ++i) {
+            if (crossed(a.move[i].raw)) {
+                rawAt = i;
+                break;
+            }
+        }
+        if (rawAt == a.move.size()) {
+            return;
+        }
+        ++a.moves;
+        const size_t n = a.chains.size();
+        for (size_t k = 0; k < n; ++k) {
+            ChainStats& c = a.chains[k];
+            size_t at = a.move.size();
+            for (size_t i = 0; i < a.move.size(); ++i) {
+                if (crossed(a.moveOut[i * n + k])) {
+                    at = i;
+                    break;
+                }
+            }
+            if (at == a.move.size()) {
+                ++c.missed;
+            } else {
+                c.lag.record(at > rawAt ? a.move[at].t - a.move[rawAt].t : 0);
+            }
+            // Settle: from the raw lever's arrival (restSinceNs) to the first
+            // step after which the output stays within kSettleBand of it.
+            size_t last = a.move.size();
+            for (size_t i = a.move.size(); i-- > 0;) {
+                if (std::fabs(a.moveOut[i * n + k] - to) > kSettleBand) {
+                    last = i;
+                    break;
+                }
+            }
+            if (last == a.move.size()) {
+                c.settle.record(0);
+            } else if (last + 1 == a.move.size()) {
+                ++c.unsettled;
+            } else {
+                const uint64_t at = a.move[last + 1].t;
+                c.settle.record(at > a.restSinceNs ? at - a.restSinceNs : 0);
+            }
+        }
+    }
+
+    std::array<Axis, fsc_proto::kChannelCount> axes_{};
+};
+
+struct ChannelStats {
+    uint64_t updates = 0;
+    uint64_t changes = 0;
+    int min = 0;
+    int max = 0;
+    int last = -1;
+    int maxJump = 0;
+    double maxJumpAtS = 0.0;
+};
+
+struct MotorStats {
+    uint64_t frames = 0;
+    int min = 0;
+    int max = 0;
+    int last = -1;
+    int lastDir = 0;
+    uint64_t reversals = 0;
+    int maxStep = 0;
+    uint64_t firstNs = 0;
+    uint64_t lastNs = 0;
+};
+
+class Analyzer {
+public:
+    explicit Analyzer(const Options& opt) : opt_(opt) {
+        if (!opt.filters.empty()) {
+            bench_ = std::make_unique<FilterBench>(opt.filters);
+        }
+    }
+
+    // Timestamps are relative to the start of a plugin session and keep
+    // counting across rotated segments. A clock that jumps back means a new
+    // session was appended; it continues the timeline where the last one ended.
+    void byte(uint64_t localNs, uint8_t dir, uint8_t value) {
+        if (sessions_ == 0 || localNs + kSessionSlackNs < lastLocalNs_) {
+            newSession();
+        }
+        lastLocalNs_ = localNs;
+        const uint64_t t = timeBaseNs_ + localNs;
+        endNs_ = std::max(endNs_, t);
+        if (dir == fsc_raw::kDirTx) {
+            txByte(t, value);
+        } else {
+            rxByte(t, value);
+        }
+    }
+
+    void report(std::string& out) const;
+
+    uint64_t lines = 0;
+    uint64_t badLines = 0;
+    uint64_t files = 0;
+    bool coarseTime = false;  // a text log was read
+
+private:
+    static constexpr uint64_t kSessionSlackNs = 1000000000ull;
+    static constexpr uint64_t kNever = ~0ull;
+
+    void newSession() {
+        ++sessions_;
+        timeBaseNs_ = endNs_;
+        rxHave_ = false;
+        txLen_ = 0;
+        lastRxNs_ = 0;
+        lastPacketNs_.fill(kNever);
+        haveLastRx_ = false;
+        lastTrimAB_ = -1;
+        if (bench_) {
+            bench_->restart();
+        }
+    }
+
+    void rxByte(uint64_t t, uint8_t b) {
+        ++rxBytes_;
+        if (haveLastRx_ && t - lastRxNs_ > opt_.gapNs) {
+            ++gaps_;
+            const uint64_t gap = t - lastRxNs_;
+            if (gap > maxGapNs_) {
+                maxGapNs_ = gap;
+                maxGapAtNs_ = lastRxNs_;
+            }
+        }
+        haveLastRx_ = true;
+        lastRxNs_ = t;
+        if (b & 0x80) {
+            if (rxHave_) {
+                ++incomplete_;  // start byte while waiting for the data byte
+            }
+            rxB1_ = b;
+            rxHave_ = true;
+            return;
+        }
+        if (!rxHave_) {
+            ++framingErrors_;
+            return;
+        }
+        rxHave_ = false;
+        packet(t, rxB1_, b);
+    }
+
+    void packet(uint64_t t, uint8_t b1, uint8_t b2) {
+        const uint8_t cmd = static_cast<uint8_t>(b1 & 0x7E);
+        const size_t slot = cmd >> 1;
+        ++packets_[slot];
+        lastData_[slot] = b2;
+        if (lastPacketNs_[slot] != kNever) {
+            intervals_[slot].record(t - lastPacketNs_[slot]);
+        }
+        lastPacketNs_[slot] = t;
+
+        const fsc_proto::CommandDesc& desc = fsc_proto::commandDesc(cmd);
+        seenTypes_ |= desc.types != fsc_proto::kTypesAll ? desc.types : 0;
+        switch (desc.kind) {
+            case fsc_proto::PacketKind::Channel:
+                channel(t, desc.channel, fsc_proto::packetValue(b1, b2));
+                break;
+            case fsc_proto::PacketKind::FlapsTrim: {
+                const uint8_t y = static_cast<uint8_t>(b2 & 0x7F);
+                const int flaps = fsc_proto::decodeFlapCode(y);
+                if (flaps >= 0) {
+                    channel(t, fsc_proto::Channel::Flaps, flaps);
+                }
+                const int ab = fsc_proto::trimWheelBits(y);
+                if (lastTrimAB_ >= 0 && ab != lastTrimAB_) {
+                    const int step = fsc_proto::trimWheelStep(lastTrimAB_, ab);
+                    trimSteps_ += step;
+                    trimStepsAbs_ += step != 0 ? 1 : 0;
+                }
+                lastTrimAB_ = ab;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    void channel(uint64_t t, fsc_proto::Channel ch, int value) {
+        const size_t i = static_cast<size_t>(ch);
+        ChannelStats& c = channels_[i];
+        if (c.updates++ == 0) {
+            c.min = c.max = value;
+        } else {
+            c.min = std::min(c.min, value);
+            c.max = std::max(c.max, value);
+            if (value != c.last) {
+                ++c.changes;
+                const int jump = std::abs(value - c.last);
+                if (jump > c.maxJump) {
+                    c.maxJump = jump;
+                    c.maxJumpAtS = static_cast<double>(t) / 1e9;
+                }
+            }
+        }
+        c.last = value;
+        if (opt_.timeline) {
+            timeline_.add(t, i, value);
+        }
+        if (bench_ && FilterBench::benched(i)) {
+            bench_->sample(t, i, value);
+        }
+    }
+
+    void txByte(uint64_t t, uint8_t b) {
+        if (b & 0x80) {
+            if (txLen_ != 0) {
+                ++txIncomplete_;
+            }
+            txLen_ = 0;
+        } else if (txLen_ == 0) {
+            ++txIncomplete_;
+            return;
+        }
+        tx_[txLen_++] = b;
+        if (txLen_ == tx_.size()) {
+            txLen_ = 0;
+            txFrame(t);
+        }
+    }
+
+    void txFrame(uint64_t t) {
+        const uint8_t a = tx_[0];
+        const uint8_t b = tx_[1];
+        const uint8_t c = tx_[2];
+        // Frame kind: 0x8B by motor target, 0x93 poll vs. power mask, others by second byte.
+        const bool poll = a == 0x93 && b == 0x00 && c == 0x10;
+        const uint8_t sub = a == 0x8B ? static_cast<uint8_t>(b & 0x70) : b;
+        auto it = std::find_if(txMix_.begin(), txMix_.end(),
+                               [&](const TxKind& k) { return k.a == a && k.b == sub && k.poll == poll; });
+        if (it == txMix_.end() && txMix_.size() < kTxKindsMax) {
+            txMix_.push_back(TxKind{a, sub, poll, 0});
+            it = txMix_.end() - 1;
+        }
+        if (it != txMix_.end()) {
+            ++it->count;
+        } else {
+            ++txOtherFrames_;
+        }
+        if (a == 0x8B) {
+            MotorStats& m = motors_[(b >> 4) & 0x07];
+            const int value = ((b & 0x01) << 7) | (c & 0x7F);
+            if (m.frames++ == 0) {
+                m.min = m.max = value;
+                m.firstNs = t;
+            } else {
+                m.min = std::min(m.min, value);
+                m.max = std::max(m.max, value);
+                const int step = value - m.last;
+                m.maxStep = std::max(m.maxStep, std::abs(step));
+                const int dir = (step > 0) - (step < 0);
+                if (dir != 0) {
+                    if (m.lastDir != 0 && dir != m.lastDir) {
+                        ++m.reversals;
+                    }
+                    m.lastDir = dir;
+                }
+            }
+            m.last = value;
+            m.lastNs = t;
+        } else if (a == 0x93 && b == 0x00 && !poll) {  // motor power mask
+            for (int bit = 0; bit < 4; ++bit) {
+                const bool on = (c >> bit) & 0x01;
+                if (on != powerOn_[bit]) {
+                    if (on) {
+                        ++powerOnCount_[bit];
+                        powerOnSince_[bit] = t;
+                    } else {
+                        powerOnNs_[bit] += t - powerOnSince_[bit];
+                    }
+                    powerOn_[bit] = on;
+                }
+            }
+        }
+    }
+
+    struct TxKind {
+        uint8_t a;
+        uint8_t b;
+        bool poll;
+        uint64_t count;
+    };
+    static constexpr size_t kTxKindsMax = 64;
+
+    const Options& opt_;
+    uint64_t sessions_ = 0;
+    uint64_t lastLocalNs_ = 0;
+    uint64_t timeBaseNs_ = 0;
+    uint64_t endNs_ = 0;
+
+    uint64_t rxBytes_ = 0;
+    bool rxHave_ = false;
+    uint8_t rxB1_ = 0;
+    bool haveLastRx_ = false;
+    uint64_t lastRxNs_ = 0;
+    uint64_t framingErrors_ = 0;
+    uint64_t incomplete_ = 0;
+    uint64_t gaps_ = 0;
+    uint64_t maxGapNs_ = 0;
+    uint64_t maxGapAtNs_ = 0;
+    uint8_t seenTypes_ = 0;
+
+    std::array<uint64_t, fsc_proto::kCommandSlots> packets_{};
+    std::array<uint8_t, fsc_proto::kCommandSlots> lastData_{};
+    std::array<uint64_t, fsc_proto::kCommandSlots> lastPacketNs_{};
+    std::array<FscLatencyHistogram, fsc_proto::kCommandSlots> intervals_{};
+    std::array<ChannelStats, fsc_proto::kChannelCount> channels_{};
+    int lastTrimAB_ = -1;
+    int64_t trimSteps_ = 0;
+    uint64_t trimStepsAbs_ = 0;
+    Timeline timeline_;
+    std::unique_ptr<FilterBench> bench_;
+
+    std::array<uint8_t, 3> tx_{};
+    size_t txLen_ = 0;
+    uint64_t txIncomplete_ = 0;
+    uint64_t txOtherFrames_ = 0;
+    std::vector<TxKind> txMix_;
+    std::array<MotorStats, 8> motors_{};
+    std::array<bool, 4> powerOn_{};
+    std::array<uint64_t, 4> powerOnCount_{};
+    std::array<uint64_t, 4> powerOnSince_{};
+    std::array<uint64_t, 4> powerOnNs_{};
+};
+
+void FilterBench::report(std::string& out, bool coarseTime) const {
+    char buf[256];
+    out += "  filter bench (noise while the lever rests, latency at the midpoint of moves, settle after them):\n";
+    if (coarseTime) {
+        out += "    (text log: samples share line timestamps, latency figures are not meaningful)\n";
+    }
+    for (size_t ch = 0; ch < axes_.size(); ++ch) {
+        const Axis& a = axes_[ch];
+        if (!benched(ch) || a.rests == 0) {
+            continue;
+        }
+        // A rest still open at the end of the capture counts as well.
+        const bool open = a.phase == Phase::Rest;
+        const uint64_t restNs =
+            a.restNs + (open && a.lastRestNs > a.restStartNs ? a.lastRestNs - a.restStartNs : 0);
+        std::snprintf(buf, sizeof(buf), "    %-10s rest %.1f s in %llu span(s), %llu move(s)", fsc_proto::kChannelNames[ch],
+                      static_cast<double>(restNs) / 1e9, static_cast<unsigned long long>(a.rests),
+                      static_cast<unsigned long long>(a.moves));
+        out += buf;
+        if (a.skippedMoves > 0) {
+            std::snprintf(buf, sizeof(buf), " (%llu too long to replay)", static_cast<unsigned long long>(a.skippedMoves));
+            out += buf;
+        }
+        out += '\n';
+        const ChainStats& base = a.chains[0];
+        const double baseRms = base.steps ? std::sqrt(base.sumSq / static_cast<double>(base.steps)) : 0.0;
+        for (size_t k = 0; k < a.chains.size(); ++k) {
+            const ChainStats& c = a.chains[k];
+            const double rms = c.steps ? std::sqrt(c.sumSq / static_cast<double>(c.steps)) : 0.0;
+            const double swing =
+                (c.swingSum + (open ? static_cast<double>(c.restMax - c.restMin) : 0.0)) / static_cast<double>(a.rests);
+            std::snprintf(buf, sizeof(buf), "      %-40s noise rms=%.3f", fsc_filter::describe(c.chain.config()).c_str(),
+                          rms);
+            out += buf;
+            if (k > 0 && baseRms > 0.0) {
+                std::snprintf(buf, sizeof(buf), " (%+.0f%%)", 100.0 * (rms - baseRms) / baseRms);
+                out += buf;
+            }
+            std::snprintf(buf, sizeof(buf), " p-p=%.2f", swing);
+            out += buf;
+            if (c.lag.total > 0) {
+                std::snprintf(buf, sizeof(buf), " latency mean=%.1f p95=%.1f max=%.1f ms",
+                              static_cast<double>(c.lag.sumNs) / static_cast<double>(c.lag.total) / 1e6,
+                              static_cast<double>(c.lag.percentile(95.0)) / 1e6, static_cast<double>(c.lag.maxNs) / 1e6);
+                out += buf;
+            }
+            if (c.missed > 0) {
+                std::snprintf(buf, sizeof(buf), " missed=%llu", static_cast<unsigned long long>(c.missed));
+                out += buf;
+            }
+            if (c.settle.total > 0) {
+                std::snprintf(buf, sizeof(buf), " settle mean=%.1f p95=%.1f max=%.1f ms",
+                              static_cast<double>(c.settle.sumNs) / static_cast<double>(c.settle.total) / 1e6,
+                              static_cast<double>(c.settle.percentile(95.0)) / 1e6,
+                              static_cast<double>(c.settle.maxNs) / 1e6);
+                out += buf;
+            }
+            if (c.unsettled > 0) {
+                std::snprintf(buf, sizeof(buf), " unsettled=%llu", static_cast<unsigned long long>(c.unsettled));
+                out += buf;
+            }
+            out += '\n';
+        }
+    }
+}
+
+const char* typeName(uint8_t types) {
+    switch (types) {
+        case fsc_proto::kTypeSemiPro: return "SEMIPRO";
+        case fsc_proto::kTypePro: return "PRO";
+        case fsc_proto::kTypeMotorized: return "MOTORIZED";
+        case fsc_proto::kTypePro | fsc_proto::kTypeMotorized: return "PRO or MOTORIZED";
+        case 0: return "unknown";
+        default: return "mixed";
+    }
+}
+
+void Analyzer::report(std::string& out) const {
+    char buf[256];
+    const double secs = static_cast<double>(endNs_) / 1e9;
+    uint64_t total = 0;
+    for (uint64_t n : packets_) {
+        total += n;
+    }
+    std::snprintf(buf, sizeof(buf),
+                  "  %llu file(s), %llu session(s), %.1f s, %llu lines (%llu unparsed)\n",
+                  static_cast<unsigned long long>(files), static_cast<unsigned long long>(sessions_), secs,
+                  static_cast<unsigned long long>(lines), static_cast<unsigned long long>(badLines));
+    out += buf;
+
+    uint8_t inferred = seenTypes_;
+    const bool motorFrames = motors_[0].frames + motors_[1].frames + motors_[2].frames + motors_[3].frames > 0;
+    if (motorFrames && (inferred == 0 || (inferred & fsc_proto::kTypeMotorized))) {
+        inferred = fsc_proto::kTypeMotorized;
+    }
+    const uint8_t type = opt_.types ? opt_.types : inferred;
+    std::snprintf(buf, sizeof(buf), "  type: %s%s\n", typeName(type), opt_.types ? "" : " (inferred)");
+    out += buf;
+
+    std::snprintf(buf, sizeof(buf),
+                  "  RX: %llu bytes, %llu packets (%.1f/s), framing errors=%llu, incomplete=%llu, "
+                  "gaps>%llums=%llu",
+                  static_cast<unsigned long long>(rxBytes_), static_cast<unsigned long long>(total),
+                  secs > 0.0 ? static_cast<double>(total) / secs : 0.0,
+                  static_cast<unsigned long long>(framingErrors_), static_cast<unsigned long long>(incomplete_),
+                  static_cast<unsigned long long>(opt_.gapNs / 1000000), static_cast<unsigned long long>(gaps_));
+    out += buf;
+    if (gaps_ > 0) {
+        std::snprintf(buf, sizeof(buf), " (max %.0f ms at %.1f s)", static_cast<double>(maxGapNs_) / 1e6,
+                      static_cast<double>(maxGapAtNs_) / 1e9);
+        out += buf;
+    }
+    out += '\n';
+
+    for (size_t slot = 0; slot < fsc_proto::kCommandSlots; ++slot) {
+        if (packets_[slot] == 0) {
+            continue;
+        }
+        const fsc_proto::CommandDesc& desc = fsc_proto::kCommandTable[slot];
+        const char* status = desc.kind == fsc_proto::PacketKind::Unknown ? "unknown"
+                             : (type == 0 || (desc.types & type)) ? "ok"
+                                                                  : "foreign";
+        std::snprintf(buf, sizeof(buf), "    0x%02X %-10s [%s] n=%llu (%.2f/s) last=0x%02X",
+                      static_cast<unsigned>(slot << 1), desc.name, status,
+                      static_cast<unsigned long long>(packets_[slot]),
+                      secs > 0.0 ? static_cast<double>(packets_[slot]) / secs : 0.0,
+                      static_cast<unsigned>(lastData_[slot]));
+        out += buf;
+        const FscLatencyHistogram& h = intervals_[slot];
+        if (h.total > 0) {
+            const double p50 = static_cast<double>(h.percentile(50.0)) / 1e6;
+            const double p99 = static_cast<double>(h.percentile(99.0)) / 1e6;
+            std::snprintf(buf, sizeof(buf), " interval p50=%.1f p99=%.1f max=%.1f ms jitter=%.1f ms", p50, p99,
+                          static_cast<double>(h.maxNs) / 1e6, p99 - p50);
+            out += buf;
+        }
+        out += '\n';
+    }
+
+    out += "  channels:\n";
+    for (size_t i = 0; i < fsc_proto::kChannelCount; ++i) {
+        const ChannelStats& c = channels_[i];
+        if (c.updates == 0) {
+            continue;
+        }
+        std::snprintf(buf, sizeof(buf),
+                      "    %-10s updates=%llu changes=%llu range=%d..%d last=%d max_jump=%d (at %.1f s)\n",
+                      fsc_proto::kChannelNames[i], static_cast<unsigned long long>(c.updates),
+                      static_cast<unsigned long long>(c.changes), c.min, c.max, c.last, c.maxJump, c.maxJumpAtS);
+        out += buf;
+    }
+    if (trimStepsAbs_ > 0) {
+        std::snprintf(buf, sizeof(buf), "    trim_wheel steps=%llu net=%lld\n",
+                      static_cast<unsigned long long>(trimStepsAbs_), static_cast<long long>(trimSteps_));
+        out += buf;
+    }
+    if (opt_.timeline) {
+        timeline_.print(out, endNs_);
+    }
+    if (bench_) {
+        bench_->report(out, coarseTime);
+    }
+
+    uint64_t txFrames = txOtherFrames_;
+    for (const TxKind& k : txMix_) {
+        txFrames += k.count;
+    }
+    std::snprintf(buf, sizeof(buf), "  TX: %llu frames (%.2f/s), incomplete=%llu\n",
+                  static_cast<unsigned long long>(txFrames),
+                  secs > 0.0 ? static_cast<double>(txFrames) / secs : 0.0,
+                  static_cast<unsigned long long>(txIncomplete_));
+    out += buf;
+    std::vector<TxKind> mix = txMix_;
+    std::sort(mix.begin(), mix.end(), [](const TxKind& l, const TxKind& r) { return l.count > r.count; });
+    for (const TxKind& k : mix) {
+        const char* what = "";
+        if (k.a == 0x8B) {
+            what = fsc_proto::motorTargetName(k.b);
+        } else if (k.a == 0x87) {
+            what = "outputs";
+        } else if (k.a == 0x93) {
+            what = k.poll ? "poll" : "motor power";
+        }
+        std::snprintf(buf, sizeof(buf), "    0x%02X 0x%02X %-20s n=%llu (%.1f%%)\n", static_cast<unsigned>(k.a),
+                      static_cast<unsigned>(k.b), what, static_cast<unsigned long long>(k.count),
+                      txFrames ? 100.0 * static_cast<double>(k.count) / static_cast<double>(txFrames) : 0.0);
+        out += buf;
+    }
+    if (txOtherFrames_ > 0) {
+        std::snprintf(buf, sizeof(buf), "    (other) n=%llu\n", static_cast<unsigned long long>(txOtherFrames_));
+        out += buf;
+    }
+
+    bool motorHeader = false;
+    for (size_t i = 0; i < motors_.size(); ++i) {
+        const MotorStats& m = motors_[i];
+        if (m.frames == 0) {
+            continue;
+        }
+        if (!motorHeader) {
+            out += "  motors:\n";
+            motorHeader = true;
+        }
+        const double span = static_cast<double>(m.lastNs - m.firstNs) / 1e9;
+        std::snprintf(buf, sizeof(buf),
+                      "    %-14s targets=%llu (%.1f/s while active) range=%d..%d max_step=%d reversals=%llu\n",
+                      fsc_proto::motorTargetName(static_cast<uint8_t>(i << 4)),
+                      static_cast<unsigned long long>(m.frames),
+                      span > 0.0 ? static_cast<double>(m.frames) / span : 0.0, m.min, m.max, m.maxStep,
+                      static_cast<unsigned long long>(m.reversals));
+        out += buf;
+    }
+    static const char* const kPowerNames[4] = {"throttle1", "throttle2", "speedbrake", "trim_indicator"};
+    for (size_t bit = 0; bit < powerOn_.size(); ++bit) {
+        if (powerOnCount_[bit] == 0) {
+            continue;
+        }
+        const uint64_t onNs = powerOnNs_[bit] + (powerOn_[bit] ? endNs_ - powerOnSince_[bit] : 0);
+        std::snprintf(buf, sizeof(buf), "    power %-14s on=%llu times, %.1f s total\n", kPowerNames[bit],
+                      static_cast<unsigned long long>(powerOnCount_[bit]), static_cast<double>(onNs) / 1e9);
+        out += buf;
+    }
+}
+
+// "<seconds> RX: 0x80 0x12 ..." (see fsc_raw::TextLineBuilder).
+bool parseTextLine(const char* line, Analyzer& a) {
+    char* end = nullptr;
+    const double seconds = std::strtod(line, &end);
+    if (end == line || seconds < 0.0) {
+        return false;
+    }
+    uint8_t dir = 0;
+    if (std::strncmp(end, " RX:", 4) == 0) {
+        dir = fsc_raw::kDirRx;
+    } else if (std::strncmp(end, " TX:", 4) == 0) {
+        dir = fsc_raw::kDirTx;
+    } else {
+        return false;
+    }
+    const uint64_t localNs = static_cast<uint64_t>(seconds * 1e9);
+    const char* p = end + 4;
+    while (*p) {
+        while (*p == ' ') {
+            ++p;
+        }
+        if (p[0] != '0' || (p[1] != 'x' && p[1] != 'X')) {
+            break;
+        }
+        char* next = nullptr;
+        const unsigned long v = std::strtoul(p + 2, &next, 16);
+        if (next == p + 2 || v > 0xFF) {
+            break;
+        }
+        a.byte(localNs, dir, static_cast<uint8_t>(v));
+        p = next;
+    }
+    return true;
+}
+
+bool analyzeFile(const std::string& path, Analyzer& a, std::string& err) {
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) {
+        err += "  cannot open " + path + "\n";
+        return false;
+    }
+    ++a.files;
+    fsc_raw::FileHeader header{};
+    const bool binary = std::fread(&header, sizeof(header), 1, f) == 1 && fsc_raw::checkHeader(header);
+    if (binary) {
+        std::vector<fsc_raw::Record> records(4096);
+        size_t n = 0;
+        while ((n = std::fread(records.data(), sizeof(fsc_raw::Record), records.size(), f)) > 0) {
+            for (size_t i = 0; i < n; ++i) {
+                const auto& rec = records[i];
+                if (rec.dir != fsc_raw::kDirRx && rec.dir != fsc_raw::kDirTx) {
+                    continue;  // recorder state samples, padding
+                }
+                const size_t count = rec.count <= fsc_raw::kRecordPayload ? rec.count : fsc_raw::kRecordPayload;
+                for (size_t b = 0; b < count; ++b) {
+                    a.byte(rec.timeNs, rec.dir, rec.bytes[b]);
+                }
+            }
+            a.lines += n;
+        }
+    } else {
+        a.coarseTime = true;
+        std::rewind(f);
+        char line[1024];
+        while (std::fgets(line, sizeof(line), f)) {
+            const size_t len = std::strlen(line);
+            if (len == sizeof(line) - 1 && line[len - 1] != '\n') {
+                // Overlong line (not written by the plugin): skip the rest of it.
+                int c = 0;
+                while ((c = std::fgetc(f)) != EOF && c != '\n') {
+                }
+                ++a.badLines;
+                continue;
+            }
+            ++a.lines;
+            if (line[0] != '\0' && line[0] != '\n' && line[0] != '\r' && !parseTextLine(line, a)) {
+                ++a.badLines;
+            }
+        }
+    }
+    std::fclose(f);
+    return true;
+}
+
+bool fileExists(const std::string& path) {
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) {
+        return false;
+    }
+    std::fclose(f);
+    return true;
+}
+
+bool isSegmentPath(const std::string& path) {
+    const size_t dot = path.rfind('.');
+    return dot != std::string::npos && dot + 2 == path.size() && path[dot + 1] >= '1' && path[dot + 1] <= '9';
+}
+
+std::string analyzeCapture(const std::string& path, const Options& opt) {
+    std::vector<std::string> files;
+    if (opt.segments && !isSegmentPath(path)) {
+        for (int i = 3; i >= 1; --i) {
+            const std::string seg = path + "." + std::to_string(i);
+            if (fileExists(seg)) {
+                files.push_back(seg);
+            }
+        }
+    }
+    files.push_back(path);
+
+    // About 130 KB of fixed state; kept off the (small) worker thread stacks.
+    auto a = std::make_unique<Analyzer>(opt);
+    std::string err;
+    for (const auto& f : files) {
+        analyzeFile(f, *a, err);
+    }
+    std::string out = path + ":\n" + err;
+    if (a->files > 0) {
+        a->report(out);
+    }
+    return out;
+}
+
+uint8_t parseType(const char* s) {
+    std::string v(s);
+    for (auto& c : v) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    if (v == "SEMIPRO" || v == "SEMI_PRO" || v == "SEMI-PRO") return fsc_proto::kTypeSemiPro;
+    if (v == "PRO") return fsc_proto::kTypePro;
+    if (v == "MOTORIZED") return fsc_proto::kTypeMotorized;
+    return 0;
+}
+
+void usage(const char* argv0) {
+    std::fprintf(stderr,
+                 "usage: %s [-j N] [--type SEMIPRO|PRO|MOTORIZED] [--gap-ms N] [--timeline] [--no-segments] "
+                 "[--filter SPEC]... <raw log>...\n",
+                 argv0);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "-j" && i + 1 < argc) {
+            opt.jobs = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--type" && i + 1 < argc) {
+            opt.types = parseType(argv[++i]);
+            if (opt.types == 0) {
+                std::fprintf(stderr, "fsc_rawstat: unknown type %s\n", argv[i]);
+                return 2;
+            }
+        } else if (arg == "--gap-ms" && i + 1 < argc) {
+            opt.gapNs = static_cast<uint64_t>(std::max(1, std::atoi(argv[++i]))) * 1000000ull;
+        } else if (arg == "--timeline") {
+            opt.timeline = true;
+        } else if (arg == "--no-segments") {
+            opt.segments = false;
+        } else if (arg == "--filter" && i + 1 < argc) {
+            fsc_filter::ChainConfig chain;
+            std::string err;
+            if (!fsc_filter::parseSpec(argv[++i], chain, err)) {
+                std::fprintf(stderr, "fsc_rawstat: --filter %s: %s\n", argv[i], err.c_str());
+                return 2;
+            }
+            opt.filters.push_back(chain);
+        } else if (!arg.empty() && arg[0] == '-') {
+            usage(argv[0]);
+            return 2;
+        } else {
+            paths.push_back(arg);
+        }
+    }
+    if (paths.empty()) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    unsigned jobs = opt.jobs ? opt.jobs : std::max(1u, std::thread::hardware_concurrency());
+    jobs = std::min<unsigned>(jobs, static_cast<unsigned>(paths.size()));
+    std::vector<std::string> reports(paths.size());
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < paths.size(); i = next++) {
+            reports[i] = analyzeCapture(paths[i], opt);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < jobs; ++t) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& t : pool) {
+        t.join();
+    }
+    for (const auto& r : reports) {
+        std::fputs(r.c_str(), stdout);
+    }
+    return 0;
+}